@@ -22,6 +22,8 @@
 
 #include "app.h"
 
+#include <thread>
+
 #include <QApplication>
 #include <QQmlApplicationEngine>
 #include <QQuickWindow>
@@ -465,9 +467,16 @@ int App::processConverter(const CommandLineParser::ConverterTask& task)
     }
 
     switch (task.type) {
-    case CommandLineParser::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, soundProfile);
-        break;
+    case CommandLineParser::ConvertType::Batch: {
+        int workers = task.params.value(CommandLineParser::ParamKey::BatchWorkers, 1).toInt();
+        if (workers <= 0) {
+            workers = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+        }
+        io::path_t reportPath = task.params[CommandLineParser::ParamKey::BatchReportPath].toString();
+        StringList workerArgs = task.params[CommandLineParser::ParamKey::BatchWorkerArgs].toStringList();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, soundProfile, static_cast<size_t>(workers), reportPath,
+                                        workerArgs);
+    } break;
     case CommandLineParser::ConvertType::File:
         ret = converter()->fileConvert(task.inputFile, task.outputFile, stylePath, forceMode, soundProfile);
         break;
@@ -494,6 +503,9 @@ int App::processConverter(const CommandLineParser::ConverterTask& task)
     case CommandLineParser::ConvertType::ExportScoreVideo: {
         ret = converter()->exportScoreVideo(task.inputFile, task.outputFile);
     } break;
+    case CommandLineParser::ConvertType::Daemon:
+        ret = converter()->runDaemon(stylePath, forceMode, soundProfile);
+        break;
     case CommandLineParser::ConvertType::SourceUpdate: {
         std::string scoreSource = task.params[CommandLineParser::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
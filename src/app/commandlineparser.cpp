@@ -84,6 +84,11 @@ void CommandLineParser::init()
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("job-workers",
+                                          "Use with '-j <file>', convert the jobs in the given number of worker processes. "
+                                          "0 means one worker per CPU core", "count"));
+    m_parser.addOption(QCommandLineOption("job-report",
+                                          "Use with '-j <file>', write a JSON report with the result and duration of each job", "file"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -103,6 +108,10 @@ void CommandLineParser::init()
                                           "Transpose the given score and export the data to a single JSON file, print it to stdout",
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("converter-daemon",
+                                          "Keep running and convert the jobs read from stdin, one JSON object per line: "
+                                          "{\"in\": \"file\", \"out\": \"file\", \"options\": {...}}. "
+                                          "The result of each job is written to stdout as one JSON object per line"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
@@ -299,6 +308,44 @@ void CommandLineParser::parse(int argc, char** argv)
         m_runMode = IApplication::RunMode::ConsoleApp;
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
+
+        if (m_parser.isSet("job-workers")) {
+            std::optional<int> val = intValue("job-workers");
+            if (val) {
+                m_converterTask.params[CommandLineParser::ParamKey::BatchWorkers] = val.value();
+            } else {
+                LOGE() << "Option: --job-workers not recognized value: " << m_parser.value("job-workers");
+            }
+        }
+
+        if (m_parser.isSet("job-report")) {
+            m_converterTask.params[CommandLineParser::ParamKey::BatchReportPath] = fromUserInputPath(m_parser.value("job-report"));
+        }
+
+        //! NOTE The options applied to every job through the configurations,
+        //! the batch workers must get them as well to write the same files
+        //! (style, force mode and sound profile are passed by the converter itself)
+        static const QStringList WORKER_OPTIONS = {
+            "d", "D", "T", "b", "template-mode", "t", "r", "M",
+            "resolution", "fps", "ls", "ts", "gp-linked", "gp-experimental", "migration"
+        };
+
+        QStringList workerArgs;
+        for (const QString& name : WORKER_OPTIONS) {
+            if (!m_parser.isSet(name)) {
+                continue;
+            }
+
+            const QString option = (name.size() == 1 ? "-" : "--") + name;
+            const QStringList values = m_parser.values(name);
+            if (values.isEmpty()) {
+                workerArgs << option;
+            }
+            for (const QString& value : values) {
+                workerArgs << option << value;
+            }
+        }
+        m_converterTask.params[CommandLineParser::ParamKey::BatchWorkerArgs] = workerArgs;
     }
 
     if (m_parser.isSet("score-media")) {
@@ -336,6 +383,11 @@ void CommandLineParser::parse(int argc, char** argv)
         m_converterTask.params[CommandLineParser::ParamKey::ScoreTransposeOptions] = m_parser.value("score-transpose");
     }
 
+    if (m_parser.isSet("converter-daemon")) {
+        m_runMode = IApplication::RunMode::ConsoleApp;
+        m_converterTask.type = ConvertType::Daemon;
+    }
+
     if (m_parser.isSet("source-update")) {
         QStringList args2 = m_parser.positionalArguments();
 
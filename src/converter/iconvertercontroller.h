@@ -36,7 +36,9 @@ public:
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out,
                             const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) = 0;
     virtual Ret batchConvert(const io::path_t& batchJobFile,
-                             const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) = 0;
+                             const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String(),
+                             size_t workers = 1, const io::path_t& reportPath = io::path_t(),
+                             const StringList& workerArgs = StringList()) = 0;
 
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
@@ -56,6 +58,10 @@ public:
     virtual Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) = 0;
 
     virtual Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
+
+    //! Keep running and convert the jobs read from stdin, one JSON object per line;
+    //! the result of each job is written to stdout, also one JSON object per line
+    virtual Ret runDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) = 0;
 };
 }
 
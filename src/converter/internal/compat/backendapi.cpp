@@ -38,6 +38,7 @@
 #include "engraving/rw/mscsaver.h"
 
 #include "backendjsonwriter.h"
+#include "base64writedevice.h"
 #include "notationmeta.h"
 
 #include "muversion.h"
@@ -66,6 +67,13 @@ static const std::string DEV_INFO_NAME = "devinfo";
 static constexpr bool ADD_SEPARATOR = true;
 static constexpr auto NO_STYLE = "";
 
+static QByteArray jsonString(const QString& str)
+{
+    //! NOTE QJsonDocument only writes arrays and objects
+    QByteArray json = QJsonDocument(QJsonArray { str }).toJson(QJsonDocument::Compact);
+    return json.mid(1, json.size() - 2);
+}
+
 Ret BackendApi::exportScoreMedia(const io::path_t& in, const io::path_t& out, const io::path_t& highlightConfigPath,
                                  const io::path_t& stylePath,
                                  bool forceMode)
@@ -384,15 +392,14 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendJsonWriter& j
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(PDF_WRITER_NAME, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
-    }
-
+    Ret ret;
     jsonWriter.addKey(PDF_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value([&ret, notation](QIODevice& device) {
+        ret = processWriter(PDF_WRITER_NAME, notation, device);
+        return ret.success();
+    }, addSeparator);
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 Ret BackendApi::exportScorePdf(const INotationPtr notation, QIODevice& destinationDevice)
@@ -527,6 +534,39 @@ mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName,
     return result;
 }
 
+Ret BackendApi::processWriter(const std::string& writerName, const INotationPtr notation, QIODevice& destinationDevice)
+{
+    auto writer = writers()->writer(writerName);
+    if (!writer) {
+        LOGW() << "Not found writer " << writerName;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Ret writeRet = writer->write(notation, destinationDevice);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    return writeRet;
+}
+
+Ret BackendApi::processWriter(const std::string& writerName, const INotationPtrList notations,
+                              const INotationWriter::Options& options, QIODevice& destinationDevice)
+{
+    auto writer = writers()->writer(writerName);
+    if (!writer) {
+        LOGW() << "Not found writer " << writerName;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Ret writeRet = writer->writeList(notations, destinationDevice, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    return writeRet;
+}
+
 Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIODevice& destinationDevice)
 {
     QJsonArray partsObjList;
@@ -572,15 +612,30 @@ Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIOD
 Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation, QIODevice& destinationDevice,
                                        const std::string& scoreFileName)
 {
-    QJsonObject jsonForPdfs;
-    jsonForPdfs["score"] = QString::fromStdString(scoreFileName);
-    QByteArray scoreBin = processWriter(PDF_WRITER_NAME, masterNotation->notation()).val;
-    jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
+    //! NOTE Each pdf is encoded into the output while it is written,
+    //! so even a large set of parts is never kept in memory
+    BackendJsonWriter jsonWriter(&destinationDevice);
+
+    jsonWriter.addKey("score");
+    jsonWriter.addValue(jsonString(QString::fromStdString(scoreFileName)), ADD_SEPARATOR, true);
+
+    Ret ret = make_ret(Ret::Code::Ok);
+    auto writePdf = [&ret](const INotationPtr notation) {
+        return [&ret, notation](QIODevice& device) {
+            Ret writeRet = processWriter(PDF_WRITER_NAME, notation, device);
+            if (!writeRet) {
+                ret = writeRet;
+            }
+            return writeRet.success();
+        };
+    };
+
+    jsonWriter.addKey("scoreBin");
+    jsonWriter.addBase64Value(writePdf(masterNotation->notation()), ADD_SEPARATOR);
 
     INotationPtrList notations;
     notations.push_back(masterNotation->notation());
 
-    QJsonArray partsArray;
     QJsonArray partsNamesArray;
 
     ExcerptNotationList excerpts = allExcerpts(masterNotation);
@@ -589,29 +644,40 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
         QJsonValue partNameVal(e->name());
         partsNamesArray.append(partNameVal);
 
-        QByteArray partBin = processWriter(PDF_WRITER_NAME, e->notation()).val;
-        QJsonValue partVal(QString::fromLatin1(partBin));
-        partsArray.append(partVal);
-
         notations.push_back(e->notation());
     }
 
-    jsonForPdfs["parts"] = partsNamesArray;
-    jsonForPdfs["partsBin"] = partsArray;
+    jsonWriter.addKey("parts");
+    jsonWriter.addValue(QJsonDocument(partsNamesArray).toJson(QJsonDocument::Compact), ADD_SEPARATOR, true);
+
+    jsonWriter.addKey("partsBin");
+    jsonWriter.openArray();
+    for (size_t i = 0; i < excerpts.size(); ++i) {
+        jsonWriter.addBase64Value(writePdf(excerpts.at(i)->notation()), i + 1 < excerpts.size());
+    }
+    jsonWriter.closeArray(ADD_SEPARATOR);
 
-    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
+    jsonWriter.addKey("scoreFullPostfix");
+    jsonWriter.addValue(jsonString(QString("-Score_and_parts") + ".pdf"), ADD_SEPARATOR, true);
 
     INotationWriter::Options options {
         { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) }
     };
 
-    QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
-    jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
-
-    QJsonDocument jsonDoc(jsonForPdfs);
-    bool ok = destinationDevice.write(QJsonDocument(jsonDoc).toJson(QJsonDocument::Compact)) != -1;
+    //! NOTE Unlike the others, this pdf is encoded twice, as the consumers expect
+    jsonWriter.addKey("scoreFullBin");
+    jsonWriter.addBase64Value([&ret, &notations, &options](QIODevice& device) {
+        Base64WriteDevice base64Device(&device);
+        base64Device.open(QIODevice::WriteOnly);
+        Ret writeRet = processWriter(PDF_WRITER_NAME, notations, options, base64Device);
+        base64Device.close();
+        if (!writeRet) {
+            ret = writeRet;
+        }
+        return writeRet.success();
+    });
 
-    return ok;
+    return ret;
 }
 
 Ret BackendApi::doExportScoreTranspose(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
@@ -80,6 +80,9 @@ private:
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtrList notations,
                                                 const project::INotationWriter::Options& options);
+    static Ret processWriter(const std::string& writerName, const notation::INotationPtr notation, QIODevice& destinationDevice);
+    static Ret processWriter(const std::string& writerName, const notation::INotationPtrList notations,
+                             const project::INotationWriter::Options& options, QIODevice& destinationDevice);
 
     static Ret doExportScoreParts(const notation::IMasterNotationPtr notation, QIODevice& destinationDevice);
     static Ret doExportScorePartsPdfs(const notation::IMasterNotationPtr notation, QIODevice& destinationDevice,
@@ -21,6 +21,8 @@
  */
 #include "backendjsonwriter.h"
 
+#include "base64writedevice.h"
+
 using namespace mu::converter;
 using namespace mu::io;
 
@@ -58,6 +60,23 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
     }
 }
 
+bool BackendJsonWriter::addBase64Value(const std::function<bool(QIODevice& device)>& writeData, bool addSeparator)
+{
+    m_destinationDevice->write("\"");
+
+    Base64WriteDevice device(m_destinationDevice);
+    device.open(QIODevice::WriteOnly);
+    bool ok = writeData(device);
+    device.close();
+
+    m_destinationDevice->write("\"");
+    if (addSeparator) {
+        m_destinationDevice->write(",\n");
+    }
+
+    return ok;
+}
+
 void BackendJsonWriter::openArray()
 {
     m_destinationDevice->write(" [");
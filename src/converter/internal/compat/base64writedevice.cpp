@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "base64writedevice.h"
+
+#include <algorithm>
+
+#include "log.h"
+
+using namespace mu::converter;
+
+//! NOTE Multiple of 3, so that there is no padding in the middle of the data
+static constexpr int BUFFER_SIZE = 3 * 16 * 1024;
+
+Base64WriteDevice::Base64WriteDevice(QIODevice* destinationDevice)
+    : m_destinationDevice(destinationDevice)
+{
+    m_buffer.reserve(BUFFER_SIZE);
+}
+
+Base64WriteDevice::~Base64WriteDevice()
+{
+    close();
+}
+
+bool Base64WriteDevice::isSequential() const
+{
+    return true;
+}
+
+void Base64WriteDevice::close()
+{
+    if (!isOpen()) {
+        return;
+    }
+
+    flush(true);
+    QIODevice::close();
+}
+
+qint64 Base64WriteDevice::readData(char*, qint64)
+{
+    return -1;
+}
+
+qint64 Base64WriteDevice::writeData(const char* data, qint64 size)
+{
+    qint64 written = 0;
+    while (written < size) {
+        int count = static_cast<int>(std::min<qint64>(size - written, BUFFER_SIZE - m_buffer.size()));
+        m_buffer.append(data + written, count);
+        written += count;
+
+        if (m_buffer.size() == BUFFER_SIZE && !flush(false)) {
+            return -1;
+        }
+    }
+
+    return written;
+}
+
+bool Base64WriteDevice::flush(bool isFinal)
+{
+    int size = isFinal ? m_buffer.size() : m_buffer.size() - m_buffer.size() % 3;
+    if (size == 0) {
+        return true;
+    }
+
+    if (m_destinationDevice->write(QByteArray::fromRawData(m_buffer.constData(), size).toBase64()) == -1) {
+        LOGE() << "failed write: " << m_destinationDevice->errorString();
+        return false;
+    }
+
+    m_buffer.remove(0, size);
+    return true;
+}
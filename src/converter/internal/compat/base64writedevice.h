@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_BASE64WRITEDEVICE_H
+#define MU_CONVERTER_BASE64WRITEDEVICE_H
+
+#include <QIODevice>
+
+namespace mu::converter {
+//! NOTE Encodes the written data to base64 and passes it to the destination device right away,
+//! so that large binaries, e.g. PDFs, are written to the backend json without being kept in memory
+class Base64WriteDevice : public QIODevice
+{
+public:
+    Base64WriteDevice(QIODevice* destinationDevice);
+    ~Base64WriteDevice() override;
+
+    bool isSequential() const override;
+
+    //! NOTE Writes the remaining data with the padding
+    void close() override;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 size) override;
+
+private:
+    bool flush(bool isFinal);
+
+    QIODevice* m_destinationDevice = nullptr;
+    QByteArray m_buffer;
+};
+}
+
+#endif // MU_CONVERTER_BASE64WRITEDEVICE_H
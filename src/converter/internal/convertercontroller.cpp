@@ -21,11 +21,27 @@
  */
 #include "convertercontroller.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QProcess>
+#include <QTemporaryDir>
+
+#ifndef Q_OS_WIN
+#include <unistd.h>
+#endif
+
+#include "concurrency/taskscheduler.h"
 
 #include "io/dir.h"
 #include "stringutils.h"
@@ -43,8 +59,45 @@ static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 static const std::string SVG_SUFFIX = "svg";
 
+//! NOTE Each worker converts several chunks, so that workers which got
+//! quick files pick up more of the remaining work
+static constexpr size_t CHUNKS_PER_WORKER = 4;
+
+static constexpr size_t MAX_OPEN_PAGE_FILES = 64;
+
+static QJsonObject jobToJson(const QString& in, const QString& out)
+{
+    QJsonObject obj;
+    obj["in"] = in;
+    obj["out"] = out;
+    return obj;
+}
+
+static bool writeJson(const mu::io::path_t& path, const QJsonDocument& doc)
+{
+    QFile file(path.toQString());
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << path;
+        return false;
+    }
+
+    file.write(doc.toJson());
+    return true;
+}
+
+QJsonObject ConverterController::jobResultToJson(const JobResult& result)
+{
+    QJsonObject obj = jobToJson(result.job.in.toQString(), result.job.out.toQString());
+    obj["success"] = result.ret.success();
+    obj["errorCode"] = result.ret.code();
+    obj["error"] = QString::fromStdString(result.ret.text());
+    obj["durationMs"] = static_cast<qint64>(result.durationMs);
+    return obj;
+}
+
 mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
-                                          const String& soundProfile)
+                                          const String& soundProfile, size_t workers, const io::path_t& reportPath,
+                                          const StringList& workerArgs)
 {
     TRACEFUNC;
 
@@ -54,13 +107,43 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
+    BatchOptions options;
+    options.stylePath = stylePath;
+    options.forceMode = forceMode;
+    options.soundProfile = soundProfile;
+    options.workerArgs = workerArgs;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    JobResults results;
+    if (workers > 1 && batchJob.val.size() > 1) {
+        results = convertJobsInWorkers(batchJob.val, options, workers);
+    } else {
+        results = convertJobs(batchJob.val, options);
+    }
+
+    if (!reportPath.empty()) {
+        QJsonArray jobs;
+        for (const JobResult& result : results) {
+            jobs.append(jobResultToJson(result));
+        }
+
+        QJsonObject report;
+        report["workers"] = static_cast<qint64>(std::max(workers, size_t(1)));
+        report["durationMs"] = timer.elapsed();
+        report["jobs"] = jobs;
+
+        writeJson(reportPath, QJsonDocument(report));
+    }
+
     StringList errors;
 
-    for (const Job& job : batchJob.val) {
-        Ret ret = fileConvert(job.in, job.out, stylePath, forceMode, soundProfile);
-        if (!ret) {
+    for (const JobResult& result : results) {
+        if (!result.ret) {
             errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
-                                .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
+                                .arg(String::fromStdString(result.ret.toString()))
+                                .arg(result.job.in.toString()).arg(result.job.out.toString()));
         }
     }
 
@@ -71,6 +154,151 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
     return make_ret(Ret::Code::Ok);
 }
 
+ConverterController::JobResults ConverterController::convertJobs(const BatchJob& batchJob, const BatchOptions& options)
+{
+    JobResults results;
+    results.reserve(batchJob.size());
+
+    for (const Job& job : batchJob) {
+        QElapsedTimer timer;
+        timer.start();
+
+        JobResult result;
+        result.job = job;
+        result.ret = fileConvert(job.in, job.out, options.stylePath, options.forceMode, options.soundProfile);
+        result.durationMs = timer.elapsed();
+
+        results.push_back(std::move(result));
+    }
+
+    return results;
+}
+
+//! NOTE Loading, layout and export rely on global state (the current project in
+//! the global context, engraving statics, fonts), so jobs are not converted on
+//! threads of this process. Instead, chunks of the batch are converted by child
+//! processes of this executable, each one a regular batch conversion with its own
+//! report. Every worker initialises fonts, styles and instruments only once for
+//! all the jobs of its chunk.
+ConverterController::JobResults ConverterController::convertJobsInWorkers(const BatchJob& batchJob, const BatchOptions& options,
+                                                                          size_t workers)
+{
+    TRACEFUNC;
+
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        LOGW() << "failed create temporary dir, converting in this process";
+        return convertJobs(batchJob, options);
+    }
+
+    const std::vector<Job> jobs(batchJob.cbegin(), batchJob.cend());
+    const size_t chunkCount = std::min(jobs.size(), workers * CHUNKS_PER_WORKER);
+
+    //! NOTE The indices of the jobs in the batch, so that repeated jobs keep their own results.
+    //! Jobs writing the same file go to the same chunk, so that they never write it concurrently
+    std::vector<std::vector<size_t> > chunks(chunkCount);
+    std::map<io::path_t, size_t> chunkOfOut;
+    size_t nextChunk = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto it = chunkOfOut.find(jobs[i].out);
+        if (it == chunkOfOut.end()) {
+            it = chunkOfOut.emplace(jobs[i].out, nextChunk).first;
+            nextChunk = (nextChunk + 1) % chunkCount;
+        }
+        chunks[it->second].push_back(i);
+    }
+
+    QStringList commonArgs;
+    if (!options.stylePath.empty()) {
+        commonArgs << "-S" << options.stylePath.toQString();
+    }
+    if (options.forceMode) {
+        commonArgs << "-f";
+    }
+    if (!options.soundProfile.isEmpty()) {
+        commonArgs << "--sound-profile" << options.soundProfile.toQString();
+    }
+    commonArgs << options.workerArgs.toQStringList();
+
+    const QString program = QCoreApplication::applicationFilePath();
+
+    JobResults results(jobs.size());
+
+    auto convertChunk = [&tempDir, &jobs, &chunks, &commonArgs, &program, &results](size_t chunkIdx) {
+        const std::vector<size_t>& chunk = chunks[chunkIdx];
+        if (chunk.empty()) {
+            return;
+        }
+
+        const io::path_t jobFile = tempDir.filePath(QString("job-%1.json").arg(chunkIdx));
+        const io::path_t reportFile = tempDir.filePath(QString("report-%1.json").arg(chunkIdx));
+
+        QJsonArray arr;
+        for (size_t jobIdx : chunk) {
+            arr.append(jobToJson(jobs[jobIdx].in.toQString(), jobs[jobIdx].out.toQString()));
+        }
+
+        QString workerError;
+        QElapsedTimer timer;
+        timer.start();
+
+        if (writeJson(jobFile, QJsonDocument(arr))) {
+            QProcess process;
+            process.setProcessChannelMode(QProcess::ForwardedChannels);
+            process.start(program, QStringList { "-j", jobFile.toQString(), "--job-report", reportFile.toQString() } + commonArgs);
+
+            if (!process.waitForFinished(-1)) {
+                workerError = process.errorString();
+            } else if (process.exitStatus() != QProcess::NormalExit) {
+                workerError = QString("worker crashed");
+            }
+        } else {
+            workerError = QString("failed write job file");
+        }
+
+        //! NOTE The worker reports its jobs in the order of its job file
+        QJsonArray reportJobs;
+        QFile file(reportFile.toQString());
+        if (file.open(QIODevice::ReadOnly)) {
+            reportJobs = QJsonDocument::fromJson(file.readAll()).object().value("jobs").toArray();
+        }
+
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            const Job& job = jobs[chunk[i]];
+            JobResult& result = results[chunk[i]];
+            result.job = job;
+
+            const int reportIdx = static_cast<int>(i);
+            const QJsonObject obj = reportIdx < reportJobs.size() ? reportJobs.at(reportIdx).toObject() : QJsonObject();
+            if (!obj.isEmpty() && obj["in"].toString() == job.in.toQString() && obj["out"].toString() == job.out.toQString()) {
+                result.ret = obj["success"].toBool() ? make_ret(Ret::Code::Ok)
+                             : Ret(obj["errorCode"].toInt(), obj["error"].toString().toStdString());
+                result.durationMs = static_cast<int64_t>(obj["durationMs"].toDouble());
+            } else {
+                // the worker didn't get to this job
+                const QString error = workerError.isEmpty() ? QString("no result from worker") : workerError;
+                result.ret = make_ret(Err::ConvertFailed, error.toStdString());
+                result.durationMs = timer.elapsed();
+            }
+        }
+    };
+
+    TaskScheduler scheduler(static_cast<thread_pool_size_t>(std::min(workers, chunkCount)));
+
+    std::vector<std::future<void> > futures;
+    futures.reserve(chunkCount);
+    for (size_t i = 0; i < chunkCount; ++i) {
+        futures.push_back(scheduler.submit(convertChunk, i));
+    }
+
+    // every chunk writes only the results of its own jobs
+    for (std::future<void>& future : futures) {
+        future.get();
+    }
+
+    return results;
+}
+
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode,
                                          const String& soundProfile)
 {
@@ -210,28 +438,40 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
-        const QString filePath
-            = io::path_t(io::dirpath(out) + "/" + io::completeBasename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
+    const size_t pageCount = notation->elements()->pages().size();
 
-        QFile file(filePath);
-        if (!file.open(QFile::WriteOnly)) {
-            return make_ret(Err::OutFileFailedOpen);
-        }
+    //! NOTE Pages are handed to the writer in groups, so that it can prepare
+    //! several of them at once without keeping too many files open
+    for (size_t groupStart = 0; groupStart < pageCount; groupStart += MAX_OPEN_PAGE_FILES) {
+        const size_t groupEnd = std::min(groupStart + MAX_OPEN_PAGE_FILES, pageCount);
+
+        std::vector<std::unique_ptr<QFile> > files;
+        std::vector<INotationWriter::PageDevice> pages;
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        for (size_t i = groupStart; i < groupEnd; i++) {
+            const QString filePath
+                = io::path_t(io::dirpath(out) + "/" + io::completeBasename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
-        file.setProperty("path", out.toQString());
+            auto file = std::make_unique<QFile>(filePath);
+            if (!file->open(QFile::WriteOnly)) {
+                return make_ret(Err::OutFileFailedOpen);
+            }
+
+            file->setProperty("path", out.toQString());
+
+            pages.push_back({ static_cast<int>(i), file.get() });
+            files.push_back(std::move(file));
+        }
 
-        Ret ret = writer->write(notation, file, options);
+        Ret ret = writer->writePages(notation, pages);
         if (!ret) {
             LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
             return make_ret(Err::OutFileFailedWrite);
         }
 
-        file.close();
+        for (auto& file : files) {
+            file->close();
+        }
     }
 
     return make_ret(Ret::Code::Ok);
@@ -392,3 +632,113 @@ mu::Ret ConverterController::updateSource(const io::path_t& in, const std::strin
 
     return BackendApi::updateSource(in, newSource, forceMode);
 }
+
+//! NOTE Jobs are read from stdin, one JSON object per line:
+//!     {"id": <any>, "in": "file.mscz", "out": "file.pdf", "options": {"style": "file.mss", "force": true, "soundProfile": "..."}}
+//! "id" and "options" are optional; missing options fall back to the ones given on the command line.
+//! For each job one line is written to stdout:
+//!     {"id": <any>, "in": ..., "out": ..., "success": true, "errorCode": 0, "error": "", "durationMs": 120}
+//! The daemon stops at the end of input, or on {"command": "quit"}.
+//! Fonts, styles, instruments and templates are loaded once on startup and stay loaded;
+//! every job gets a new project, which is released after the job.
+mu::Ret ConverterController::runDaemon(const io::path_t& stylePath, bool forceMode, const String& soundProfile)
+{
+    TRACEFUNC;
+
+    //! NOTE stdout carries the protocol only: everything else written to it (the console log, prints of
+    //! the loading and export code) goes to stderr while the daemon runs. On Windows the console log
+    //! doesn't go to stdout
+    std::cout.flush();
+    std::fflush(stdout);
+    FILE* protocol = stdout;
+#ifndef Q_OS_WIN
+    const int protocolFd = dup(STDOUT_FILENO);
+    FILE* protocolFile = protocolFd >= 0 ? fdopen(protocolFd, "w") : nullptr;
+    if (protocolFile) {
+        protocol = protocolFile;
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+    } else if (protocolFd >= 0) {
+        close(protocolFd);
+    }
+#endif
+
+    auto writeLine = [protocol](const QJsonObject& obj) {
+        const QByteArray data = QJsonDocument(obj).toJson(QJsonDocument::Compact) + '\n';
+        std::fwrite(data.constData(), 1, data.size(), protocol);
+        std::fflush(protocol);
+    };
+
+    QJsonObject ready;
+    ready["ready"] = true;
+    writeLine(ready);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        strings::trim(line);
+        if (line.empty()) {
+            continue;
+        }
+
+        QJsonParseError err;
+        const QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+        if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+            QJsonObject response;
+            response["success"] = false;
+            response["errorCode"] = static_cast<int>(Err::BatchJobFileFailedParse);
+            response["error"] = err.errorString();
+            writeLine(response);
+            continue;
+        }
+
+        const QJsonObject request = doc.object();
+        if (request["command"].toString() == "quit") {
+            break;
+        }
+
+        const QJsonObject options = request["options"].toObject();
+
+        JobResult result;
+        result.job.in = io::Dir::fromNativeSeparators(request["in"].toString());
+        result.job.out = io::Dir::fromNativeSeparators(request["out"].toString());
+
+        QElapsedTimer timer;
+        timer.start();
+
+        if (result.job.in.empty() || result.job.out.empty()) {
+            result.ret = make_ret(Err::BatchJobFileFailedParse, "\"in\" and \"out\" are required");
+        } else {
+            const io::path_t jobStylePath = options.contains("style")
+                                            ? io::Dir::fromNativeSeparators(options["style"].toString()) : stylePath;
+            const bool jobForceMode = options.contains("force") ? options["force"].toBool() : forceMode;
+            const String jobSoundProfile = options.contains("soundProfile")
+                                           ? String::fromQString(options["soundProfile"].toString()) : soundProfile;
+
+            result.ret = fileConvert(result.job.in, result.job.out, jobStylePath, jobForceMode, jobSoundProfile);
+        }
+
+        result.durationMs = timer.elapsed();
+
+        // make sure nothing of this job stays alive until the next one: the event loop
+        // doesn't run while the daemon waits for input, so handle posted events here
+        globalContext()->setCurrentProject(nullptr);
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        QCoreApplication::processEvents();
+
+        QJsonObject response = jobResultToJson(result);
+        if (request.contains("id")) {
+            response["id"] = request["id"];
+        }
+        writeLine(response);
+    }
+
+#ifndef Q_OS_WIN
+    if (protocol != stdout) {
+        std::cout.flush();
+        std::fflush(stdout);
+        dup2(fileno(protocol), STDOUT_FILENO);
+        std::fclose(protocol);
+    }
+#endif
+
+    return make_ret(Ret::Code::Ok);
+}
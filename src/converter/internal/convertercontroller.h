@@ -23,6 +23,7 @@
 #define MU_CONVERTER_CONVERTERCONTROLLER_H
 
 #include <list>
+#include <vector>
 
 #include "../iconvertercontroller.h"
 
@@ -34,6 +35,8 @@
 
 #include "types/retval.h"
 
+class QJsonObject;
+
 namespace mu::converter {
 class ConverterController : public IConverterController
 {
@@ -48,7 +51,9 @@ public:
     Ret fileConvert(const io::path_t& in, const io::path_t& out,
                     const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) override;
     Ret batchConvert(const io::path_t& batchJobFile,
-                     const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) override;
+                     const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String(),
+                     size_t workers = 1, const io::path_t& reportPath = io::path_t(),
+                     const StringList& workerArgs = StringList()) override;
 
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
@@ -69,6 +74,8 @@ public:
 
     Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
+    Ret runDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false, const String& soundProfile = String()) override;
+
 private:
 
     struct Job {
@@ -78,8 +85,28 @@ private:
 
     using BatchJob = std::list<Job>;
 
+    struct JobResult {
+        Job job;
+        Ret ret;
+        int64_t durationMs = 0;
+    };
+
+    using JobResults = std::vector<JobResult>;
+
+    struct BatchOptions {
+        io::path_t stylePath;
+        bool forceMode = false;
+        String soundProfile;
+        StringList workerArgs; // the other command line options of the jobs, passed on to the worker processes
+    };
+
+    static QJsonObject jobResultToJson(const JobResult& result);
+
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
 
+    JobResults convertJobs(const BatchJob& batchJob, const BatchOptions& options);
+    JobResults convertJobsInWorkers(const BatchJob& batchJob, const BatchOptions& options, size_t workers);
+
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
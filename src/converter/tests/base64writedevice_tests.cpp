@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <QBuffer>
+
+#include "converter/internal/compat/base64writedevice.h"
+
+using namespace mu::converter;
+
+class Converter_Base64WriteDeviceTests : public ::testing::Test
+{
+public:
+    //! NOTE The size of the internal buffer of Base64WriteDevice
+    static constexpr int BUFFER_SIZE = 3 * 16 * 1024;
+
+    static QByteArray data(int size)
+    {
+        QByteArray result(size, Qt::Uninitialized);
+        for (int i = 0; i < size; ++i) {
+            result[i] = static_cast<char>((i * 7 + i / 251) & 0xff);
+        }
+        return result;
+    }
+
+    static QByteArray encode(const QByteArray& input, int chunkSize)
+    {
+        QByteArray output;
+        QBuffer destination(&output);
+        destination.open(QIODevice::WriteOnly);
+
+        Base64WriteDevice device(&destination);
+        device.open(QIODevice::WriteOnly);
+        for (int pos = 0; pos < input.size(); pos += chunkSize) {
+            EXPECT_NE(device.write(input.constData() + pos, std::min(chunkSize, input.size() - pos)), -1);
+        }
+        device.close();
+
+        return output;
+    }
+};
+
+TEST_F(Converter_Base64WriteDeviceTests, SameAsToBase64)
+{
+    //! GIVEN Sizes around the buffer size, with every remainder of the division by 3
+    std::vector<int> sizes = { 0, 1, 2, 3, 4, 5 };
+    for (int base : { BUFFER_SIZE, 2 * BUFFER_SIZE, 3 * BUFFER_SIZE + 1 }) {
+        for (int delta = -3; delta <= 3; ++delta) {
+            sizes.push_back(base + delta);
+        }
+    }
+
+    for (int size : sizes) {
+        const QByteArray input = data(size);
+        const QByteArray expected = input.toBase64();
+
+        //! CHECK Written at once, in chunks not aligned to 3 and in chunks larger than the buffer
+        for (int chunkSize : { std::max(size, 1), 1000, 7, BUFFER_SIZE + 5 }) {
+            EXPECT_EQ(encode(input, chunkSize), expected) << "size " << size << ", chunk size " << chunkSize;
+        }
+    }
+}
+
+TEST_F(Converter_Base64WriteDeviceTests, ClosedByDestructor)
+{
+    //! GIVEN Data that leaves a remainder in the buffer
+    const QByteArray input = data(BUFFER_SIZE + 2);
+
+    QByteArray output;
+    QBuffer destination(&output);
+    destination.open(QIODevice::WriteOnly);
+
+    //! DO Write without closing
+    {
+        Base64WriteDevice device(&destination);
+        device.open(QIODevice::WriteOnly);
+        device.write(input);
+    }
+
+    //! CHECK The remainder is written with the padding
+    EXPECT_EQ(output, input.toBase64());
+}
@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2024 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Converts the same batch in this process and in worker processes,
+# with the per job options, and checks that both write the same files.
+# Usage: batchworkers_tests.sh <mscore binary> <test scores dir>
+
+set -o pipefail
+
+MSCORE_BIN="$1"
+SCORES_DIR="$2"
+
+if [ -z "$MSCORE_BIN" ] || [ -z "$SCORES_DIR" ]; then
+    echo "Usage: $0 <mscore binary> <test scores dir>"
+    exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+SCORES="beams-11.mscx chord-layout-10.mscx lyrics-1.mscx tremolo-tab-2.mscx"
+OPTIONS="-r 50 -T 4 -t"
+
+write_job_file() {
+    local out_dir="$1"
+    local job_file="$2"
+    mkdir -p "$out_dir"
+    echo "[" > "$job_file"
+    for score in $SCORES ; do
+        echo "{ \"in\" : \"$SCORES_DIR/$score\", \"out\" : \"$out_dir/${score%.*}.png\" }," >> "$job_file"
+        echo "{ \"in\" : \"$SCORES_DIR/$score\", \"out\" : \"$out_dir/${score%.*}.mscx\" }," >> "$job_file"
+    done
+    # a repeated job has its own entry in the report
+    echo "{ \"in\" : \"$SCORES_DIR/lyrics-1.mscx\", \"out\" : \"$out_dir/lyrics-1-repeat.mscx\" }" >> "$job_file"
+    echo "]" >> "$job_file"
+}
+
+write_job_file "$WORK_DIR/inprocess" "$WORK_DIR/inprocess.json"
+write_job_file "$WORK_DIR/workers" "$WORK_DIR/workers.json"
+
+$MSCORE_BIN -j "$WORK_DIR/inprocess.json" $OPTIONS || { echo "In process conversion failed"; exit 1; }
+$MSCORE_BIN -j "$WORK_DIR/workers.json" --job-workers 2 --job-report "$WORK_DIR/report.json" $OPTIONS \
+    || { echo "Conversion in workers failed"; exit 1; }
+
+FAILED=""
+
+for file in $(cd "$WORK_DIR/inprocess" && ls) ; do
+    if ! cmp -s "$WORK_DIR/inprocess/$file" "$WORK_DIR/workers/$file" ; then
+        echo "Differs: $file"
+        FAILED="true"
+    fi
+done
+
+if [ "$(ls "$WORK_DIR/inprocess" | wc -l)" != "$(ls "$WORK_DIR/workers" | wc -l)" ]; then
+    echo "Different sets of files written"
+    FAILED="true"
+fi
+
+JOB_COUNT=$(grep -c "\"in\"" "$WORK_DIR/workers.json")
+REPORT_COUNT=$(grep -c "\"in\"" "$WORK_DIR/report.json")
+if [ "$JOB_COUNT" != "$REPORT_COUNT" ]; then
+    echo "Report has $REPORT_COUNT entries for $JOB_COUNT jobs"
+    FAILED="true"
+fi
+
+if [ -n "$FAILED" ]; then
+    exit 1
+fi
+
+echo "Batch conversion in workers wrote the same files"
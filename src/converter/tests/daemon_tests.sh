@@ -0,0 +1,74 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2024 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Feeds jobs to the converter daemon and checks that its stdout is the protocol only:
+# every line is a JSON object, the ready line first, then one response per job.
+# Usage: daemon_tests.sh <mscore binary> <test scores dir>
+
+set -o pipefail
+
+MSCORE_BIN="$1"
+SCORES_DIR="$2"
+
+if [ -z "$MSCORE_BIN" ] || [ -z "$SCORES_DIR" ]; then
+    echo "Usage: $0 <mscore binary> <test scores dir>"
+    exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+{
+    echo "{ \"id\" : 1, \"in\" : \"$SCORES_DIR/beams-11.mscx\", \"out\" : \"$WORK_DIR/beams-11.png\" }"
+    echo "{ \"id\" : 2, \"in\" : \"$SCORES_DIR/lyrics-1.mscx\", \"out\" : \"$WORK_DIR/lyrics-1.mscx\" }"
+    echo "{ \"command\" : \"quit\" }"
+} > "$WORK_DIR/jobs.jsonl"
+
+$MSCORE_BIN --converter-daemon < "$WORK_DIR/jobs.jsonl" > "$WORK_DIR/stdout.jsonl" 2> "$WORK_DIR/stderr.log" \
+    || { echo "Daemon failed"; cat "$WORK_DIR/stderr.log"; exit 1; }
+
+python3 - "$WORK_DIR/stdout.jsonl" <<'PYTHON'
+import json
+import sys
+
+with open(sys.argv[1]) as f:
+    lines = f.read().splitlines()
+
+try:
+    objects = [json.loads(line) for line in lines]
+except ValueError as e:
+    print("Not a JSON line on stdout: %s" % e)
+    print("\n".join(lines))
+    sys.exit(1)
+
+if len(objects) != 3 or objects[0] != {"ready": True}:
+    print("Expected the ready line and 2 responses, got:")
+    print("\n".join(lines))
+    sys.exit(1)
+
+for obj, id in zip(objects[1:], [1, 2]):
+    if obj.get("id") != id or not obj.get("success"):
+        print("Job %d failed: %s" % (id, json.dumps(obj)))
+        sys.exit(1)
+PYTHON
+[ $? -eq 0 ] || exit 1
+
+echo "Converter daemon wrote only the protocol to stdout"
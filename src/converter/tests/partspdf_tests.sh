@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2024 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Exports the score and parts PDFs of a score with parts to the backend JSON
+# and checks that the JSON parses and that every binary decodes to a PDF,
+# the full score twice as it is encoded twice.
+# Usage: partspdf_tests.sh <mscore binary> <score with parts>
+
+set -o pipefail
+
+MSCORE_BIN="$1"
+SCORE="$2"
+
+if [ -z "$MSCORE_BIN" ] || [ -z "$SCORE" ]; then
+    echo "Usage: $0 <mscore binary> <score with parts>"
+    exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+$MSCORE_BIN --score-parts-pdf "$SCORE" -o "$WORK_DIR/parts.json" || { echo "Export failed"; exit 1; }
+
+python3 - "$WORK_DIR/parts.json" <<'PYTHON'
+import base64
+import json
+import sys
+
+with open(sys.argv[1]) as f:
+    try:
+        doc = json.load(f)
+    except ValueError as e:
+        print("Invalid JSON: %s" % e)
+        sys.exit(1)
+
+def checkPdf(name, data):
+    try:
+        pdf = base64.b64decode(data, validate=True)
+    except ValueError as e:
+        print("%s is not base64: %s" % (name, e))
+        sys.exit(1)
+    if not pdf.startswith(b"%PDF"):
+        print("%s is not a PDF" % name)
+        sys.exit(1)
+
+checkPdf("scoreBin", doc["scoreBin"])
+
+if len(doc["parts"]) == 0 or len(doc["parts"]) != len(doc["partsBin"]):
+    print("Expected a binary for every part, got %d parts and %d binaries" % (len(doc["parts"]), len(doc["partsBin"])))
+    sys.exit(1)
+
+for name, data in zip(doc["parts"], doc["partsBin"]):
+    checkPdf("part " + name, data)
+
+try:
+    scoreFull = base64.b64decode(doc["scoreFullBin"], validate=True)
+except ValueError as e:
+    print("scoreFullBin is not base64: %s" % e)
+    sys.exit(1)
+checkPdf("scoreFullBin", scoreFull)
+PYTHON
+[ $? -eq 0 ] || exit 1
+
+echo "Score and parts PDFs exported to valid JSON"
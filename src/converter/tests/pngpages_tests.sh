@@ -0,0 +1,100 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2024 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Exports a score to PNG page by page, where the pages are handed to the
+# writer in groups, and checks that every page is the same as the one written
+# by a separate call per page in the score media export.
+# A small page size makes the score longer than one group of pages.
+# Usage: pngpages_tests.sh <mscore binary> <score>
+
+set -o pipefail
+
+MSCORE_BIN="$1"
+SCORE="$2"
+
+if [ -z "$MSCORE_BIN" ] || [ -z "$SCORE" ]; then
+    echo "Usage: $0 <mscore binary> <score>"
+    exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+cat > "$WORK_DIR/style.mss" <<'STYLE'
+<?xml version="1.0" encoding="UTF-8"?>
+<museScore version="4.00">
+  <Style>
+    <pageHeight>2.5</pageHeight>
+    <pageEvenTopMargin>0.2</pageEvenTopMargin>
+    <pageEvenBottomMargin>0.2</pageEvenBottomMargin>
+    <pageOddTopMargin>0.2</pageOddTopMargin>
+    <pageOddBottomMargin>0.2</pageOddBottomMargin>
+  </Style>
+</museScore>
+STYLE
+
+OPTIONS="-r 20 -S $WORK_DIR/style.mss"
+
+mkdir -p "$WORK_DIR/pages"
+$MSCORE_BIN -o "$WORK_DIR/pages/score.png" $OPTIONS "$SCORE" || { echo "Page by page export failed"; exit 1; }
+$MSCORE_BIN --score-media "$SCORE" -o "$WORK_DIR/media.json" $OPTIONS || { echo "Score media export failed"; exit 1; }
+
+python3 - "$WORK_DIR/media.json" "$WORK_DIR/pages" <<'PYTHON'
+import base64
+import json
+import os
+import sys
+
+# More than the number of files the converter opens at once
+MIN_PAGE_COUNT = 65
+
+with open(sys.argv[1]) as f:
+    pngs = json.load(f)["pngs"]
+
+pagesDir = sys.argv[2]
+pageFiles = os.listdir(pagesDir)
+
+if len(pngs) < MIN_PAGE_COUNT:
+    print("Expected at least %d pages, got %d" % (MIN_PAGE_COUNT, len(pngs)))
+    sys.exit(1)
+
+if len(pageFiles) != len(pngs):
+    print("Written %d files for %d pages" % (len(pageFiles), len(pngs)))
+    sys.exit(1)
+
+failed = False
+for i, png in enumerate(pngs):
+    name = "score-%d.png" % (i + 1)
+    path = os.path.join(pagesDir, name)
+    if not os.path.exists(path):
+        print("Missing: %s" % name)
+        failed = True
+        continue
+    with open(path, "rb") as page:
+        if page.read() != base64.b64decode(png):
+            print("Differs: %s" % name)
+            failed = True
+
+sys.exit(1 if failed else 0)
+PYTHON
+[ $? -eq 0 ] || exit 1
+
+echo "Pages written in groups are the same as the ones written one by one"
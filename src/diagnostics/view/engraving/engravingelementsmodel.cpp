@@ -359,6 +359,11 @@ void EngravingElementsModel::updateInfo()
         m_summary.clear();
         QTextStream stream(&m_summary);
         stream << "Total: " << elements.size();
+
+        notation::INotationPtr notation = globalContext()->currentNotation();
+        if (notation && notation->undoStack()) {
+            stream << ", undo history: " << notation->undoStack()->memoryUsage() / 1024 << " KB";
+        }
     }
 
     emit infoChanged();
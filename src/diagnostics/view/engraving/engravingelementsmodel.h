@@ -28,6 +28,7 @@
 #include "modularity/ioc.h"
 #include "../../iengravingelementsprovider.h"
 #include "actions/iactionsdispatcher.h"
+#include "context/iglobalcontext.h"
 
 namespace mu::diagnostics {
 class EngravingElementsModel : public QAbstractItemModel
@@ -38,6 +39,7 @@ class EngravingElementsModel : public QAbstractItemModel
 
     INJECT(IEngravingElementsProvider, elementsProvider)
     INJECT(actions::IActionsDispatcher, dispatcher)
+    INJECT(context::IGlobalContext, globalContext)
 
 public:
     EngravingElementsModel(QObject* parent = 0);
@@ -22,6 +22,8 @@
 
 #include "event.h"
 
+#include <algorithm>
+
 #include "dom/note.h"
 #include "dom/sig.h"
 
@@ -200,7 +202,98 @@ void EventList::insert(const Event& e)
     push_back(e);
 }
 
-EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
+//---------------------------------------------------------
+//   EventsChannel
+//---------------------------------------------------------
+
+void EventsChannel::insert(const value_type& value)
+{
+    if (_sorted && !_events.empty() && value.first < _events.back().first) {
+        _sorted = false;
+    }
+    _events.push_back(value);
+}
+
+//! NOTE As with std::multimap::merge, the merged events come after the events at the same tick
+void EventsChannel::merge(EventsChannel& other)
+{
+    if (&other == this || other.empty()) {
+        return;
+    }
+
+    other.ensureSorted();
+    if (_sorted && !_events.empty() && other._events.front().first < _events.back().first) {
+        _sorted = false;
+    }
+    _events.insert(_events.end(), other._events.cbegin(), other._events.cend());
+    other.clear();
+}
+
+void EventsChannel::clear()
+{
+    _events.clear();
+    _sorted = true;
+}
+
+void EventsChannel::ensureSorted() const
+{
+    if (_sorted) {
+        return;
+    }
+
+    std::stable_sort(_events.begin(), _events.end(), [](const value_type& a, const value_type& b) {
+        return a.first < b.first;
+    });
+    _sorted = true;
+}
+
+EventsChannel::iterator EventsChannel::lower_bound(int tick)
+{
+    return std::lower_bound(begin(), end(), tick, [](const value_type& v, int t) { return v.first < t; });
+}
+
+EventsChannel::const_iterator EventsChannel::lower_bound(int tick) const
+{
+    return std::lower_bound(begin(), end(), tick, [](const value_type& v, int t) { return v.first < t; });
+}
+
+EventsChannel::iterator EventsChannel::upper_bound(int tick)
+{
+    return std::upper_bound(begin(), end(), tick, [](int t, const value_type& v) { return t < v.first; });
+}
+
+EventsChannel::const_iterator EventsChannel::upper_bound(int tick) const
+{
+    return std::upper_bound(begin(), end(), tick, [](int t, const value_type& v) { return t < v.first; });
+}
+
+EventsChannel::iterator EventsChannel::find(int tick)
+{
+    auto it = lower_bound(tick);
+    return (it != _events.end() && it->first == tick) ? it : _events.end();
+}
+
+EventsChannel::const_iterator EventsChannel::find(int tick) const
+{
+    auto it = lower_bound(tick);
+    return (it != _events.cend() && it->first == tick) ? it : _events.cend();
+}
+
+size_t EventsChannel::count(int tick) const
+{
+    return static_cast<size_t>(upper_bound(tick) - lower_bound(tick));
+}
+
+EventsChannel::iterator EventsChannel::erase(iterator it)
+{
+    return _events.erase(it);
+}
+
+//---------------------------------------------------------
+//   EventsHolder
+//---------------------------------------------------------
+
+EventsChannel& EventsHolder::operator[](std::size_t idx)
 {
     if (size() == 0) {
         _channels.emplace_back();
@@ -214,7 +307,7 @@ EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
     return _channels[idx];
 }
 
-const EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx) const
+const EventsChannel& EventsHolder::operator[](std::size_t idx) const
 {
     // Since EventsHolder acts more like a vector
     // Using const subscript operator for a nonexistent element is UB
@@ -230,6 +323,8 @@ const EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
 void EventsHolder::mergePitchWheelEvents(EventsHolder& pitchWheelEvents)
 {
     for (size_t i = 0; i < size(); ++i) {
+        //! NOTE The resets are added after the iteration, which keeps them after the events at the same tick as a multimap did
+        EventsChannel pwResets;
         for (const auto& eventPair : _channels[i]) {
             const auto& event = eventPair.second;
             const auto& tick = eventPair.first;
@@ -240,10 +335,11 @@ void EventsHolder::mergePitchWheelEvents(EventsHolder& pitchWheelEvents)
                     PitchWheelSpecs specs;
                     NPlayEvent pwReset(ME_PITCHBEND, (uint8_t)i, specs.mLimit % 128, specs.mLimit / 128);
                     pwReset.setOriginatingStaff(pwEvent->second.getOriginatingStaff());
-                    _channels[i].insert(std::pair<int, NPlayEvent>(((tick - pwEvent->first) / 2) + pwEvent->first, pwReset));
+                    pwResets.insert(std::pair<int, NPlayEvent>(((tick - pwEvent->first) / 2) + pwEvent->first, pwReset));
                 }
             }
         }
+        _channels[i].merge(pwResets);
         _channels[i].merge(pitchWheelEvents[i]);
     }
 }
@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_COMPAT_EVENT_H
 
 #include <map>
+#include <utility>
 #include <vector>
 
 #include <compat/midi/midiinstrumenteffects.h>
@@ -165,6 +166,7 @@ public:
 
 //---------------------------------------------------------
 //   EventList
+//   EventsChannel
 //   EventsHolder
 //---------------------------------------------------------
 
@@ -176,16 +178,58 @@ public:
     void insertNote(int channel, Note*);
 };
 
+//! NOTE The events of a channel by tick, with the ordering of a std::multimap:
+//! events at the same tick keep their insertion order.
+//! They are appended to a vector and sorted on the first access,
+//! which is much cheaper than a tree when rendering long scores
+class EventsChannel
+{
+public:
+    using key_type = int;
+    using value_type = std::pair<int, NPlayEvent>;
+    using container_t = std::vector<value_type>;
+    using iterator = container_t::iterator;
+    using const_iterator = container_t::const_iterator;
+
+    void insert(const value_type& value);
+    void merge(EventsChannel& other);
+
+    [[nodiscard]] size_t size() const { return _events.size(); }
+    [[nodiscard]] bool empty() const { return _events.empty(); }
+    void clear();
+
+    iterator begin() { ensureSorted(); return _events.begin(); }
+    iterator end() { ensureSorted(); return _events.end(); }
+    const_iterator begin() const { ensureSorted(); return _events.cbegin(); }
+    const_iterator end() const { ensureSorted(); return _events.cend(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    iterator lower_bound(int tick);
+    const_iterator lower_bound(int tick) const;
+    iterator upper_bound(int tick);
+    const_iterator upper_bound(int tick) const;
+    iterator find(int tick);
+    const_iterator find(int tick) const;
+    size_t count(int tick) const;
+    iterator erase(iterator it);
+
+private:
+    void ensureSorted() const;
+
+    mutable container_t _events;
+    mutable bool _sorted = true;
+};
+
 class EventsHolder
 {
     OBJECT_ALLOCATOR(engraving, EventsHolder)
 
-    using events_multimap_t = std::multimap<int, NPlayEvent>;
-    std::vector<events_multimap_t> _channels;
+    std::vector<EventsChannel> _channels;
 public:
     [[nodiscard]] size_t size() const { return _channels.size(); }
-    events_multimap_t& operator[](std::size_t idx);
-    const events_multimap_t& operator[](std::size_t idx) const;
+    EventsChannel& operator[](std::size_t idx);
+    const EventsChannel& operator[](std::size_t idx) const;
     void mergePitchWheelEvents(EventsHolder& pitchWheelEvents);
     void fixupMIDI();
 };
@@ -337,6 +337,27 @@ void Score::undoRedo(bool undo, EditData* ed)
     changesChannel().send(range);
 }
 
+//---------------------------------------------------------
+//   startPropertyBatch
+///   Collect the property changes made by undoChangeProperty()
+///   until endPropertyBatch(), including their propagation to
+///   linked parts, into a single undo command.
+//---------------------------------------------------------
+
+void Score::startPropertyBatch()
+{
+    undoStack()->beginPropertyBatch();
+}
+
+//---------------------------------------------------------
+//   endPropertyBatch
+//---------------------------------------------------------
+
+void Score::endPropertyBatch()
+{
+    undoStack()->endPropertyBatch();
+}
+
 //---------------------------------------------------------
 //   endCmd
 ///   End a GUI command by (if \a undo) ending a user-visible undo
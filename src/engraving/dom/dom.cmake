@@ -47,8 +47,6 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/bracketItem.h
     ${CMAKE_CURRENT_LIST_DIR}/breath.cpp
     ${CMAKE_CURRENT_LIST_DIR}/breath.h
-    ${CMAKE_CURRENT_LIST_DIR}/bsp.cpp
-    ${CMAKE_CURRENT_LIST_DIR}/bsp.h
     ${CMAKE_CURRENT_LIST_DIR}/bsymbol.cpp
     ${CMAKE_CURRENT_LIST_DIR}/bsymbol.h
     ${CMAKE_CURRENT_LIST_DIR}/changeMap.cpp
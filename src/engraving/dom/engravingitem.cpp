@@ -110,6 +110,10 @@ EngravingItem::~EngravingItem()
 {
     Score::onElementDestruction(this);
 
+    if (m_layoutData && m_layoutData->isItemsIndexDirty()) {
+        Score::removeItemsIndexDirtyItem(this);
+    }
+
     delete m_layoutData;
 }
 
@@ -1592,6 +1596,12 @@ void EngravingItem::drawSymbols(const SymIdList& symbols, mu::draw::Painter* p,
     score()->engravingFont()->draw(symbols, p, SizeF(magS() * scale), o);
 }
 
+void EngravingItem::drawSymbols(const SymIdList& symbols, const std::vector<PointF>& positions, mu::draw::Painter* p, double scale) const
+{
+    const double mag = magS() * scale;
+    score()->engravingFont()->draw(symbols, positions, p, SizeF(mag, mag));
+}
+
 //---------------------------------------------------------
 //   symHeight
 //---------------------------------------------------------
@@ -2409,7 +2419,9 @@ const EngravingItem::LayoutData* EngravingItem::ldata() const
 
 EngravingItem::LayoutData* EngravingItem::mutldata()
 {
-    return mutldataInternal();
+    LayoutData* ldata = mutldataInternal();
+    ldata->m_displayList.reset();
+    return ldata;
 }
 
 const EngravingItem::LayoutData* EngravingItem::ldataInternal() const
@@ -2438,9 +2450,18 @@ void EngravingItem::LayoutData::setBbox(const mu::RectF& r)
     DO_ASSERT(!std::isnan(r.height()) && !std::isinf(r.height()));
 
     //DO_ASSERT(!isShapeComposite());
+    markItemsIndexDirty();
     m_shape.set_value(Shape(r, m_item, Shape::Type::Fixed));
 }
 
+void EngravingItem::LayoutData::doMarkItemsIndexDirty()
+{
+    Score* score = m_item ? m_item->score() : nullptr;
+    if (score) {
+        m_itemsIndexDirty = score->addItemsIndexDirtyItem(m_item);
+    }
+}
+
 const RectF& EngravingItem::LayoutData::bbox(LD_ACCESS mode) const
 {
     //! NOTE Temporary disabled CHECK - a lot of messages
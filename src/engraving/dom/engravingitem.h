@@ -31,6 +31,7 @@
 #include "draw/types/color.h"
 #include "draw/types/geometry.h"
 #include "draw/painter.h"
+#include "draw/types/displaylist.h"
 
 #include "modularity/ioc.h"
 #include "iengravingconfiguration.h"
@@ -451,6 +452,7 @@ public:
     void drawSymbol(SymId id, mu::draw::Painter* p, const PointF& o = PointF(), double scale = 1.0) const;
     void drawSymbols(const SymIdList&, mu::draw::Painter* p, const PointF& o = PointF(), double scale = 1.0) const;
     void drawSymbols(const SymIdList&, mu::draw::Painter* p, const PointF& o, const SizeF& scale) const;
+    void drawSymbols(const SymIdList&, const std::vector<PointF>& positions, mu::draw::Painter* p, double scale = 1.0) const;
     double symHeight(SymId id) const;
     double symWidth(SymId id) const;
     double symWidth(const SymIdList&) const;
@@ -510,6 +512,7 @@ public:
 
         virtual void reset()
         {
+            markItemsIndexDirty();
             m_shape.reset();
             //! NOTE Temporary removed, have problems, need investigation
             //m_pos.reset();
@@ -520,6 +523,16 @@ public:
         bool isSkipDraw() const { return m_isSkipDraw; }
         void setIsSkipDraw(bool val) { m_isSkipDraw = val; }
 
+        //! NOTE Recorded draw calls of the item, reset by any change of the layout data.
+        //! The list is owned by the display list cache of the paint target, see rendering::DisplayListCache
+        draw::DisplayListPtr displayList() const { return m_displayList.lock(); }
+        void setDisplayList(const draw::DisplayListPtr& list) const { m_displayList = list; }
+
+        //! NOTE Set when the position or the shape changes, the items index of the page
+        //! is then updated for the system of the item only, see Page::updateItemsIndex
+        bool isItemsIndexDirty() const { return m_itemsIndexDirty; }
+        void setItemsIndexDirty(bool val) const { m_itemsIndexDirty = val; }
+
         double mag() const { return m_mag; }
         void setMag(double val) { m_mag = val; }
 
@@ -540,14 +553,14 @@ public:
         void moveY(double y) { doSetPos(pos(LD_ACCESS::MAYBE_NOTINITED).x(), pos(LD_ACCESS::MAYBE_NOTINITED).y() + y); }
 
         bool isSetBbox() const { return m_shape.has_value(); }
-        void clearBbox() { m_shape.reset(); }
+        void clearBbox() { markItemsIndexDirty(); m_shape.reset(); }
         const RectF& bbox(LD_ACCESS mode = LD_ACCESS::CHECK) const;
 
         bool isSetShape() const { return m_shape.has_value(); }
-        void clearShape() { m_shape.reset(); }
+        void clearShape() { markItemsIndexDirty(); m_shape.reset(); }
         Shape shape(LD_ACCESS mode = LD_ACCESS::CHECK) const;
 
-        void setShape(const Shape& sh) { m_shape.set_value(sh); }
+        void setShape(const Shape& sh) { markItemsIndexDirty(); m_shape.set_value(sh); }
 
         void setBbox(const mu::RectF& r);
 
@@ -594,11 +607,23 @@ public:
 #ifndef NDEBUG
             doSetPosDebugHook(x, y);
 #endif
+            if (!m_pos.has_value() || m_pos.value().x() != x || m_pos.value().y() != y) {
+                markItemsIndexDirty();
+            }
             m_pos.mut_value().setX(x),
             m_pos.mut_value().setY(y);
         }
 
-        Shape& mutShape() { return m_shape.mut_value(); }
+        inline void markItemsIndexDirty()
+        {
+            if (!m_itemsIndexDirty) {
+                doMarkItemsIndexDirty();
+            }
+        }
+
+        void doMarkItemsIndexDirty();
+
+        Shape& mutShape() { markItemsIndexDirty(); return m_shape.mut_value(); }
         bool isShapeComposite() const { return m_shape.has_value() && m_shape.value().isComposite(); }
 
         friend class EngravingItem;
@@ -606,6 +631,8 @@ public:
         const EngravingItem* m_item = nullptr;
         bool m_isSkipDraw = false;
         double m_mag = 1.0;                     // standard magnification (derived value)
+        mutable std::weak_ptr<const draw::DisplayList> m_displayList;
+        mutable bool m_itemsIndexDirty = false;
         ld_field<PointF> m_pos = "pos";         // Reference position, relative to _parent, set by autoplace
         ld_field<Shape> m_shape = "shape";
     };
@@ -75,6 +75,7 @@ EngravingObject::EngravingObject(const ElementType& type, EngravingObject* paren
             MasterScore* ms = s->masterScore();
             if (ms) {
                 m_eid = ms->getEID()->newEID(m_type);
+                s->eidRegister()->registerItem(this);
             }
         }
     }
@@ -107,6 +108,7 @@ EngravingObject::EngravingObject(const EngravingObject& se)
             MasterScore* ms = s->masterScore();
             if (ms) {
                 m_eid = ms->getEID()->newEID(m_type);
+                s->eidRegister()->registerItem(this);
             }
         }
     }
@@ -153,6 +155,14 @@ EngravingObject::~EngravingObject()
         elementsProvider()->unreg(this);
     }
 
+    //! NOTE The element can outlive its score (e.g. when held by an undo stack or a clipboard),
+    //! the score has then already unregistered it, see Score::~Score
+    if (m_eid.isValid() && m_score && Score::validScores.count(m_score)) {
+        if (EIDRegister* reg = m_score->eidRegister()) {
+            reg->unregisterItem(this);
+        }
+    }
+
     if (m_links) {
         m_links->remove(this);
         if (m_links->empty()) {
@@ -190,6 +200,17 @@ void EngravingObject::doSetScore(Score* sc)
         return;
     }
 
+    EIDRegister* oldRegister = m_score ? m_score->eidRegister() : nullptr;
+    EIDRegister* newRegister = sc ? sc->eidRegister() : nullptr;
+    if (oldRegister != newRegister && m_eid.isValid()) {
+        if (oldRegister) {
+            oldRegister->unregisterItem(this);
+        }
+        if (newRegister) {
+            newRegister->registerItem(this);
+        }
+    }
+
     m_score = sc;
 
     for (EngravingObject* ch : m_children) {
@@ -197,6 +218,24 @@ void EngravingObject::doSetScore(Score* sc)
     }
 }
 
+//---------------------------------------------------------
+//   setEID
+//---------------------------------------------------------
+
+void EngravingObject::setEID(EID id)
+{
+    EIDRegister* reg = m_score ? m_score->eidRegister() : nullptr;
+    if (reg) {
+        reg->unregisterItem(this);
+    }
+
+    m_eid = id;
+
+    if (reg) {
+        reg->registerItem(this);
+    }
+}
+
 void EngravingObject::moveToDummy()
 {
     Score* sc = score();
@@ -405,6 +444,8 @@ static void changeProperty(EngravingObject* e, Pid t, const PropertyValue& st, P
         if (e->isBracketItem()) {
             BracketItem* bi = toBracketItem(e);
             e->score()->undo(new ChangeBracketProperty(bi->staff(), bi->column(), t, st, ps));
+        } else if (ChangeProperties* batch = e->score()->undoStack()->currentPropertyBatch()) {
+            batch->applyChange(e, t, st, ps);
         } else {
             e->score()->undo(new ChangeProperty(e, t, st, ps));
         }
@@ -220,7 +220,7 @@ public:
     virtual String translatedTypeUserName() const;
 
     inline EID eid() const { return m_eid; }
-    inline void setEID(EID id) { m_eid = id; }
+    void setEID(EID id);
 
     EngravingObject* parent() const;
     void setParent(EngravingObject* p);
@@ -363,6 +363,42 @@ void Excerpt::setVoiceVisible(Staff* staff, voice_idx_t voiceIndex, bool visible
 }
 
 void Excerpt::createExcerpt(Excerpt* excerpt)
+{
+    createExcerpts({ excerpt });
+}
+
+void Excerpt::createExcerpts(const std::vector<Excerpt*>& excerpts)
+{
+    TRACEFUNC;
+
+    if (excerpts.empty()) {
+        return;
+    }
+
+    //! NOTE: Cloning links the new elements to the master score and records undo commands
+    //! on the master undo stack, so this part has to stay sequential
+    for (Excerpt* excerpt : excerpts) {
+        cloneExcerptContents(excerpt);
+    }
+
+    //! NOTE: The MIDI mapping of the master score covers all excerpts,
+    //! so it is enough to rebuild it once for the whole batch
+    MasterScore* masterScore = excerpts.front()->masterScore();
+    masterScore->rebuildMidiMapping();
+    masterScore->updateChannel();
+
+    // second layout of scores
+    for (Excerpt* excerpt : excerpts) {
+        Score* score = excerpt->excerptScore();
+        score->setPlaylistDirty();
+        score->remapBracketsAndBarlines();
+
+        score->setLayoutAll();
+        score->doLayout();
+    }
+}
+
+void Excerpt::cloneExcerptContents(Excerpt* excerpt)
 {
     MasterScore* masterScore = excerpt->masterScore();
     Score* score = excerpt->excerptScore();
@@ -499,15 +535,6 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
         score->spatiumChanged(masterScore->style().spatium(), score->style().spatium());
         score->styleChanged();
     }
-
-    // second layout of score
-    score->setPlaylistDirty();
-    masterScore->rebuildMidiMapping();
-    masterScore->updateChannel();
-    score->remapBracketsAndBarlines();
-
-    score->setLayoutAll();
-    score->doLayout();
 }
 
 void MasterScore::deleteExcerpt(Excerpt* excerpt)
@@ -577,18 +604,34 @@ void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
 
 void MasterScore::initExcerpt(Excerpt* excerpt)
 {
-    if (excerpt->inited()) {
-        excerpt->excerptScore()->doLayout();
-        return;
+    initExcerpts({ excerpt });
+}
+
+void MasterScore::initExcerpts(const std::vector<Excerpt*>& excerpts)
+{
+    TRACEFUNC;
+
+    std::vector<Excerpt*> excerptsToCreate;
+
+    for (Excerpt* excerpt : excerpts) {
+        if (excerpt->inited()) {
+            excerpt->excerptScore()->doLayout();
+            continue;
+        }
+
+        Score* score = new Score(masterScore());
+        excerpt->setExcerptScore(score);
+        score->style().set(Sid::createMultiMeasureRests, true);
+        initParts(excerpt);
+
+        excerptsToCreate.push_back(excerpt);
     }
 
-    Score* score = new Score(masterScore());
-    excerpt->setExcerptScore(score);
-    score->style().set(Sid::createMultiMeasureRests, true);
-    initParts(excerpt);
+    Excerpt::createExcerpts(excerptsToCreate);
 
-    Excerpt::createExcerpt(excerpt);
-    excerpt->setInited(true);
+    for (Excerpt* excerpt : excerptsToCreate) {
+        excerpt->setInited(true);
+    }
 }
 
 void MasterScore::initParts(Excerpt* excerpt)
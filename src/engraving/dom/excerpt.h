@@ -86,6 +86,7 @@ public:
     static std::vector<Excerpt*> createExcerptsFromParts(const std::vector<Part*>& parts, MasterScore* score);
 
     static void createExcerpt(Excerpt*);
+    static void createExcerpts(const std::vector<Excerpt*>& excerpts);
     static void cloneStaves(Score* sourceScore, Score* dstScore, const std::vector<staff_idx_t>& sourceStavesIndexes,
                             const TracksMap& allTracks);
     static void cloneMeasures(Score* oscore, Score* score);
@@ -96,6 +97,8 @@ public:
 private:
     friend class MasterScore;
 
+    static void cloneExcerptContents(Excerpt* excerpt);
+
     void setInited(bool inited);
     void writeNameToMetaTags();
 
@@ -163,6 +163,7 @@ public:
 
     void initAndAddExcerpt(Excerpt*, bool);
     void initExcerpt(Excerpt*);
+    void initExcerpts(const std::vector<Excerpt*>& excerpts);
     void initEmptyExcerpt(Excerpt*);
 
     void setPlaybackScore(Score*);
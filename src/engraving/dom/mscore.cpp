@@ -63,6 +63,7 @@ double MScore::nudgeStep;
 double MScore::nudgeStep10;
 double MScore::nudgeStep50;
 int MScore::defaultPlayDuration;
+size_t MScore::undoMemoryBudget = 0;
 
 int MScore::sampleRate  = 44100;
 int MScore::mtcType;
@@ -207,6 +207,7 @@ public:
     static double nudgeStep10;
     static double nudgeStep50;
     static int defaultPlayDuration;
+    static size_t undoMemoryBudget;     // bytes retained by undo history, 0 = unlimited
 
 // #ifndef NDEBUG
     static bool noHorizontalStretch;
@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <unordered_set>
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -51,7 +53,7 @@ static String revision;
 Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), m_no(0)
 {
-    m_bspTreeValid = false;
+    m_itemsIndexValid = false;
 }
 
 //---------------------------------------------------------
@@ -60,18 +62,28 @@ Page::Page(RootItem* parent)
 
 std::vector<EngravingItem*> Page::items(const RectF& rect)
 {
-    if (!m_bspTreeValid) {
-        doRebuildBspTree();
-    }
-    return bspTree.items(rect);
+    updateItemsIndex();
+
+    std::vector<EngravingItem*> result;
+    m_itemsIndex.forEachIntersecting(rect, [&rect, &result](EngravingItem* item, const RectF& itemRect) {
+        if (itemRect.intersects(rect)) {
+            result.push_back(item);
+        }
+    });
+    return result;
 }
 
 std::vector<EngravingItem*> Page::items(const mu::PointF& point)
 {
-    if (!m_bspTreeValid) {
-        doRebuildBspTree();
-    }
-    return bspTree.items(point);
+    updateItemsIndex();
+
+    std::vector<EngravingItem*> result;
+    m_itemsIndex.forEachIntersecting(RectF(point, SizeF()), [&point, &result](EngravingItem* item, const RectF&) {
+        if (item->contains(point)) {
+            result.push_back(item);
+        }
+    });
+    return result;
 }
 
 //---------------------------------------------------------
@@ -248,47 +260,97 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
 }
 
 //---------------------------------------------------------
-//   bspInsert
+//   updateItemsIndex
+//    Only the systems marked by the layout of their items,
+//    and the systems which were added to or removed from the page,
+//    are scanned again. Removed items are only compared by pointer,
+//    never accessed.
 //---------------------------------------------------------
 
-static void bspInsert(void* bspTree, EngravingItem* e)
+static void collectItem(void* data, EngravingItem* e)
 {
-    ((BspTree*)bspTree)->insert(e);
+    static_cast<std::vector<EngravingItem*>*>(data)->push_back(e);
 }
 
-static void countElements(void* data, EngravingItem* /*e*/)
+void Page::updateItemsIndex()
 {
-    ++(*(int*)data);
-}
+    score()->applyItemsIndexDirtyItems();
 
-//---------------------------------------------------------
-//   doRebuildBspTree
-//---------------------------------------------------------
+    std::unordered_set<const EngravingItem*> groups(m_systems.begin(), m_systems.end());
+    groups.insert(this);
 
-void Page::doRebuildBspTree()
-{
-    int n = 0;
-    scanElements(&n, countElements, false);
-
-    RectF r;
-    if (score()->linearMode()) {
-        double w = 0.0;
-        double h = 0.0;
-        if (!m_systems.empty()) {
-            h = m_systems.front()->height();
-            if (!m_systems.front()->measures().empty()) {
-                MeasureBase* mb = m_systems.front()->measures().back();
-                w = mb->x() + mb->width();
+    if (!m_itemsIndexValid) {
+        m_itemsIndexDirtyGroups.insert(groups.begin(), groups.end());
+        m_itemsIndexValid = true;
+    }
+
+    for (auto it = m_itemsIndexGroups.begin(); it != m_itemsIndexGroups.end();) {
+        if (groups.find(it->first) != groups.end()) {
+            ++it;
+            continue;
+        }
+
+        for (EngravingItem* item : it->second) {
+            auto groupIt = m_itemsIndexGroupOf.find(item);
+            if (groupIt != m_itemsIndexGroupOf.end() && groupIt->second == it->first) {
+                m_itemsIndexGroupOf.erase(groupIt);
+                m_itemsIndex.remove(item);
             }
         }
-        r = RectF(0.0, 0.0, w, h);
-    } else {
-        r = abbox();
+        it = m_itemsIndexGroups.erase(it);
+    }
+
+    for (const EngravingItem* group : groups) {
+        if (m_itemsIndexGroups.find(group) == m_itemsIndexGroups.end()) {
+            m_itemsIndexDirtyGroups.insert(group);
+        }
+    }
+
+    if (m_itemsIndexDirtyGroups.empty()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    std::vector<std::pair<const EngravingItem*, std::vector<EngravingItem*> > > scanned;
+    for (System* system : m_systems) {
+        if (m_itemsIndexDirtyGroups.find(system) == m_itemsIndexDirtyGroups.end()) {
+            continue;
+        }
+
+        std::vector<EngravingItem*> items;
+        for (MeasureBase* m : system->measures()) {
+            m->scanElements(&items, collectItem, false);
+        }
+        system->scanElements(&items, collectItem, false);
+        scanned.emplace_back(system, std::move(items));
     }
 
-    bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
-    m_bspTreeValid = true;
+    if (m_itemsIndexDirtyGroups.find(this) != m_itemsIndexDirtyGroups.end()) {
+        scanned.emplace_back(this, std::vector<EngravingItem*> { this });
+    }
+
+    m_itemsIndexDirtyGroups.clear();
+
+    //! NOTE All removals go first, an item may have moved to another system of the page
+    for (const auto& [group, items] : scanned) {
+        std::unordered_set<const EngravingItem*> current(items.begin(), items.end());
+        for (EngravingItem* item : m_itemsIndexGroups[group]) {
+            auto groupIt = m_itemsIndexGroupOf.find(item);
+            if (groupIt != m_itemsIndexGroupOf.end() && groupIt->second == group && current.find(item) == current.end()) {
+                m_itemsIndexGroupOf.erase(groupIt);
+                m_itemsIndex.remove(item);
+            }
+        }
+    }
+
+    for (auto& [group, items] : scanned) {
+        for (EngravingItem* item : items) {
+            m_itemsIndexGroupOf[item] = group;
+            m_itemsIndex.update(item, item->pageBoundingRect());
+        }
+        m_itemsIndexGroups[group] = std::move(items);
+    }
 }
 
 //---------------------------------------------------------
@@ -23,10 +23,12 @@
 #ifndef MU_ENGRAVING_PAGE_H
 #define MU_ENGRAVING_PAGE_H
 
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "engravingitem.h"
-#include "bsp.h"
+#include "infrastructure/rtree.h"
 
 namespace mu::engraving {
 class RootItem;
@@ -75,7 +77,8 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { m_bspTreeValid = false; }
+    void invalidateItemsIndex() { m_itemsIndexValid = false; }
+    void invalidateItemsIndex(const EngravingItem* group) { m_itemsIndexDirtyGroups.insert(group); }
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -92,14 +95,19 @@ private:
     friend class Factory;
     Page(RootItem* parent);
 
-    void doRebuildBspTree();
+    void updateItemsIndex();
     String replaceTextMacros(const String&) const;
 
     std::vector<System*> m_systems;
     page_idx_t m_no = 0;                        // page number
 
-    BspTree bspTree;
-    bool m_bspTreeValid = false;
+    //! NOTE Updated only for the systems whose items changed since the last query,
+    //! the items which are not in a system are grouped under the page
+    RTree<EngravingItem*> m_itemsIndex;
+    std::unordered_map<const EngravingItem*, std::vector<EngravingItem*> > m_itemsIndexGroups;
+    std::unordered_map<const EngravingItem*, const EngravingItem*> m_itemsIndexGroupOf;
+    std::unordered_set<const EngravingItem*> m_itemsIndexDirtyGroups;
+    bool m_itemsIndexValid = false;
 };
 } // namespace mu::engraving
 #endif
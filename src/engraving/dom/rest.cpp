@@ -158,7 +158,6 @@ mu::RectF Rest::drag(EditData& ed)
 
     renderer()->layoutItem(this);
 
-    score()->rebuildBspTree();
     return abbox().united(r);
 }
 
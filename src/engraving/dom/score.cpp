@@ -232,6 +232,11 @@ Score::~Score()
 {
     Score::validScores.erase(this);
 
+    // the elements of a part can outlive it, the register of the master score must not keep them
+    if (m_masterScore && m_masterScore != this) {
+        eidRegister()->unregisterItemsOf(this);
+    }
+
     for (MuseScoreView* v : m_viewer) {
         v->removeScore();
     }
@@ -696,10 +701,10 @@ void Score::dragPosition(const PointF& p, staff_idx_t* rst, Segment** seg, doubl
 void Score::setShowInvisible(bool v)
 {
     m_showInvisible = v;
-    // BSP tree does not include elements which are not
+    // The items index does not include elements which are not
     // displayed, so we need to refresh it to get
     // invisible elements displayed or properly hidden.
-    rebuildBspTree();
+    invalidateItemsIndex();
 }
 
 //---------------------------------------------------------
@@ -4254,6 +4259,18 @@ void Score::undo(UndoCommand* cmd, EditData* ed) const
     undoStack()->push(cmd, ed);
 }
 
+//---------------------------------------------------------
+//   itemByEID
+///   Find an object of this score, one of its parts or
+///   the master score by its EID, without walking the tree.
+//---------------------------------------------------------
+
+EngravingObject* Score::itemByEID(const EID& eid) const
+{
+    const EIDRegister* reg = eidRegister();
+    return reg ? reg->itemFromEID(eid) : nullptr;
+}
+
 //---------------------------------------------------------
 //   linkId
 //---------------------------------------------------------
@@ -5493,13 +5510,60 @@ ShadowNote* Score::shadowNote() const
     return m_shadowNote;
 }
 
-void Score::rebuildBspTree()
+void Score::invalidateItemsIndex()
 {
     for (Page* page : pages()) {
-        page->invalidateBspTree();
+        page->invalidateItemsIndex();
     }
 }
 
+//---------------------------------------------------------
+//   addItemsIndexDirtyItem
+//    Returns false if there is no page to update yet,
+//    a new page indexes all its items on the first query.
+//---------------------------------------------------------
+
+bool Score::addItemsIndexDirtyItem(const EngravingItem* item)
+{
+    if (m_pages.empty()) {
+        return false;
+    }
+
+    m_itemsIndexDirtyItems.insert(item);
+    return true;
+}
+
+void Score::removeItemsIndexDirtyItem(const EngravingItem* item)
+{
+    //! NOTE The item may have been moved to another score since it was marked
+    for (Score* score : validScores) {
+        score->m_itemsIndexDirtyItems.erase(item);
+    }
+}
+
+//---------------------------------------------------------
+//   applyItemsIndexDirtyItems
+//    Marks the systems of the changed items to be indexed again
+//    on their pages, the items outside of a system belong to the page.
+//---------------------------------------------------------
+
+void Score::applyItemsIndexDirtyItems()
+{
+    for (const EngravingItem* item : m_itemsIndexDirtyItems) {
+        item->ldata()->setItemsIndexDirty(false);
+
+        const EngravingItem* system = item->findAncestor(ElementType::SYSTEM);
+        const EngravingItem* page = (system ? system : item)->findAncestor(ElementType::PAGE);
+        if (!page) {
+            continue;
+        }
+
+        const_cast<Page*>(toPage(page))->invalidateItemsIndex(system ? system : page);
+    }
+
+    m_itemsIndexDirtyItems.clear();
+}
+
 //---------------------------------------------------------
 //   scanElements
 //    scan all elements
@@ -5644,6 +5708,13 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
         end = std::max(et, spanner->tick2());
     }
 
+    if (isLayoutPending() && m_layoutOptions.pageLimit == 0) {
+        end = Fraction(-1, 1);
+    }
+
+    //! NOTE Set again by the page view layout, if it stops at the page limit
+    m_layoutPendingTick = Fraction(-1, 1);
+
     m_engravingFont = engravingFonts()->fontByName(style().value(Sid::MusicalSymbolFont).value<String>().toStdString());
     m_layoutOptions.noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, style().spatium() / SPATIUM20);
 
@@ -5670,6 +5741,28 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     }
 }
 
+//---------------------------------------------------------
+//   continueLayout
+//    lay out the next pageCount pages of a progressive layout,
+//    all the remaining ones if pageCount is 0
+//---------------------------------------------------------
+
+void Score::continueLayout(size_t pageCount)
+{
+    TRACEFUNC;
+
+    if (!isLayoutPending()) {
+        return;
+    }
+
+    //! NOTE A layout from the first tick is a complete one, it would start over
+    size_t pageLimit = m_layoutPendingTick.isZero() ? 0 : pageCount;
+
+    m_layoutOptions.pageLimit = pageLimit;
+    doLayoutRange(m_layoutPendingTick, Fraction(-1, 1));
+    m_layoutOptions.pageLimit = 0;
+}
+
 void Score::createPaddingTable()
 {
     m_paddingTable.createTable(style());
@@ -6054,6 +6147,7 @@ void Score::updateVelo()
 }
 
 UndoStack* Score::undoStack() const { return m_masterScore->undoStack(); }
+EIDRegister* Score::eidRegister() const { return m_masterScore ? &m_masterScore->m_eidRegister : nullptr; }
 const RepeatList& Score::repeatList()  const { return m_masterScore->repeatList(); }
 const RepeatList& Score::repeatList(bool expandRepeats)  const { return m_masterScore->repeatList(expandRepeats); }
 TempoMap* Score::tempomap() const { return m_masterScore->tempomap(); }
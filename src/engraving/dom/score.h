@@ -29,6 +29,7 @@
 */
 
 #include <set>
+#include <unordered_set>
 #include <memory>
 #include <optional>
 
@@ -42,6 +43,8 @@
 
 #include "types/constants.h"
 
+#include "infrastructure/eidregister.h"
+
 #include "rendering/iscorerenderer.h"
 #include "rendering/layoutoptions.h"
 #include "rendering/paddingtable.h"
@@ -258,6 +261,7 @@ public:
     virtual bool readOnly() const;
 
     static void onElementDestruction(EngravingItem* se);
+    static void removeItemsIndexDirtyItem(const EngravingItem* item);
 
     // Score Tree functions
     EngravingObject* scanParent() const override;
@@ -276,7 +280,9 @@ public:
 
     mu::async::Channel<EngravingItem*> elementDestroyed();
 
-    void rebuildBspTree();
+    void invalidateItemsIndex();
+    bool addItemsIndexDirtyItem(const EngravingItem* item);
+    void applyItemsIndexDirtyItems();
     bool noStaves() const { return m_staves.empty(); }
     void insertPart(Part*, size_t targetPartIdx);
     void appendPart(Part*);
@@ -401,6 +407,9 @@ public:
     void undoPropertyChanged(EngravingObject*, Pid, const PropertyValue& v, PropertyFlags ps = PropertyFlags::NOSTYLE);
     virtual UndoStack* undoStack() const;
     void undo(UndoCommand*, EditData* = nullptr) const;
+
+    EIDRegister* eidRegister() const;
+    EngravingObject* itemByEID(const EID& eid) const;
     void undoRemoveMeasures(Measure*, Measure*, bool preserveTies = false);
     void undoChangeMeasureRepeatCount(Measure* m, int count, staff_idx_t staffIdx);
     void undoAddBracket(Staff* staff, size_t level, BracketType type, size_t span);
@@ -485,6 +494,8 @@ public:
 
     void startCmd();                    // start undoable command
     void endCmd(bool rollback = false, bool layoutAllParts = false); // end undoable command
+    void startPropertyBatch();          // collect following property changes into one undo command
+    void endPropertyBatch();
     void update() { update(true); }
     void lockUpdates(bool locked);
     void undoRedo(bool undo, EditData*);
@@ -773,6 +784,14 @@ public:
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
 
+    //! NOTE The page view of a large score may be laid out progressively:
+    //! a layout with the page limit stops after that many pages, continueLayout lays out the next ones.
+    //! Any layout without the limit completes the pending one
+    void setLayoutPageLimit(size_t pageCount) { m_layoutOptions.pageLimit = pageCount; }
+    bool isLayoutPending() const { return m_layoutPendingTick >= Fraction(0, 1); }
+    void setLayoutPendingTick(const Fraction& tick) { m_layoutPendingTick = tick; }
+    void continueLayout(size_t pageCount = 0);
+
     SynthesizerState& synthesizerState() { return m_synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
 
@@ -1027,6 +1046,9 @@ private:
 
     int m_linkId = 0;
     MasterScore* m_masterScore = nullptr;
+    // Used by the master score only. Lives in Score rather than in MasterScore,
+    // so that it outlives the objects deleted by ~Score()
+    EIDRegister m_eidRegister;
     std::list<MuseScoreView*> m_viewer;
     Excerpt* m_excerpt = nullptr;
 
@@ -1086,11 +1108,15 @@ private:
 
     RootItem* m_rootItem = nullptr;
     LayoutOptions m_layoutOptions;
+    Fraction m_layoutPendingTick = Fraction(-1, 1); // the first tick which is not laid out yet
 
     mu::async::Channel<EngravingItem*> m_elementDestroyed;
 
     ShadowNote* m_shadowNote = nullptr;
 
+    //! NOTE The items whose layout changed since the items index of the pages was last updated
+    std::unordered_set<const EngravingItem*> m_itemsIndexDirtyItems;
+
     mu::async::Channel<POS, unsigned> m_posChanged;
 
     PaddingTable m_paddingTable;
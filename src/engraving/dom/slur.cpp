@@ -426,7 +426,7 @@ bool Slur::isDirectionMixture(Chord* c1, Chord* c2)
 
 void Slur::setTrack(track_idx_t n)
 {
-    EngravingItem::setTrack(n);
+    Spanner::setTrack(n);
     for (SpannerSegment* ss : spannerSegments()) {
         ss->setTrack(n);
     }
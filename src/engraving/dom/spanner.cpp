@@ -1323,7 +1323,26 @@ void Spanner::setTicks(const Fraction& f)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().spannerTicksChanged(this);
+    }
+}
+
+//---------------------------------------------------------
+//   setTrack
+//---------------------------------------------------------
+
+void Spanner::setTrack(track_idx_t v)
+{
+    if (track() == v) {
+        return;
+    }
+
+    EngravingItem::setTrack(v);
+
+    Score* score = this->score();
+
+    if (score) {
+        score->spannerMap().spannerTrackChanged(this);
     }
 }
 
@@ -169,6 +169,7 @@ public:
     void setTicks(const Fraction&);
 
     bool isVoiceSpecific() const;
+    void setTrack(track_idx_t v) override;
     track_idx_t track2() const { return m_track2; }
     void setTrack2(track_idx_t v) { m_track2 = v; }
     track_idx_t effectiveTrack2() const { return m_track2 == mu::nidx ? track() : m_track2; }
@@ -21,6 +21,9 @@
  */
 
 #include "spannermap.h"
+
+#include <algorithm>
+
 #include "spanner.h"
 #include "part.h"
 
@@ -39,6 +42,18 @@ SpannerMap::SpannerMap()
     m_dirty = true;
 }
 
+//---------------------------------------------------------
+//   groupKey
+//    spanners of the same type in the same part are
+//    trimmed against each other in the collision free tree
+//---------------------------------------------------------
+
+SpannerMap::GroupKey SpannerMap::groupKey(const Spanner* s)
+{
+    const Part* part = s->part();
+    return { part ? part->id() : ID(), s->type() };
+}
+
 //---------------------------------------------------------
 //   update
 //   updates the internal lookup tree, not the map itself
@@ -46,14 +61,230 @@ SpannerMap::SpannerMap()
 
 void SpannerMap::update() const
 {
-    IntervalList regularIntervals;
-    IntervalList collisionFreeIntervals;
+    m_tree.clear();
+    m_collisionFreeTree.clear();
+    m_groups.clear();
+    m_entries.clear();
+
+    for (const auto& pair : *this) {
+        Spanner* spanner = pair.second;
+
+        Group& group = m_groups[groupKey(spanner)];
+        group.insert(group.end(), pair);
 
-    collectIntervals(regularIntervals, collisionFreeIntervals);
+        interval_tree::Interval<Spanner*> interval(spanner->tick().ticks(), spanner->tick2().ticks(), spanner);
+        m_tree.insert(interval);
+
+        SpannerEntry& entry = m_entries[spanner];
+        entry.groupKey = groupKey(spanner);
+        entry.mapKey = pair.first;
+        entry.start = interval.start;
+    }
+
+    for (const auto& pair : m_groups) {
+        for (auto it = pair.second.cbegin(); it != pair.second.cend(); ++it) {
+            updateCollisionFreeInterval(it, pair.second);
+        }
+    }
 
-    m_tree = interval_tree::IntervalTree<Spanner*>(std::move(regularIntervals));
-    m_collisionFreeTree = interval_tree::IntervalTree<Spanner*>(std::move(collisionFreeIntervals));
     m_dirty = false;
+    ++m_stats.fullRebuilds;
+}
+
+//---------------------------------------------------------
+//   updateCollisionFreeInterval
+//    (re)inserts the collision free interval of the given
+//    spanner, which depends on the start of the next
+//    spanner in the same group
+//---------------------------------------------------------
+
+void SpannerMap::updateCollisionFreeInterval(Group::const_iterator it, const Group& group) const
+{
+    //!Note Because of the current UX of spanners adjustments spanners collision is a regular thing,
+    //!     so we have to manage those cases when two similar spanners (e.g. Pedal line) are overlapping
+    //!     with each other.
+    constexpr int collidingSpannersPadding = 1;
+
+    Spanner* spanner = it->second;
+    SpannerEntry& entry = m_entries[spanner];
+
+    if (entry.hasCollisionFreeInterval) {
+        m_collisionFreeTree.remove(entry.start, spanner);
+    }
+
+    interval_tree::Interval<Spanner*> interval(spanner->tick().ticks(), spanner->tick2().ticks(), spanner);
+
+    auto nextIt = std::next(it);
+    if (nextIt != group.cend()) {
+        int nextSpannerStartTick = nextIt->second->tick().ticks();
+        if (interval.stop >= nextSpannerStartTick && !spanner->isLinked(nextIt->second)) {
+            interval.stop = nextSpannerStartTick - collidingSpannersPadding;
+        }
+    }
+
+    m_collisionFreeTree.insert(interval);
+    entry.hasCollisionFreeInterval = true;
+}
+
+//---------------------------------------------------------
+//   addToTrees
+//---------------------------------------------------------
+
+void SpannerMap::addToTrees(Spanner* s, int mapKey) const
+{
+    GroupKey key = groupKey(s);
+    Group& group = m_groups[key];
+    auto it = group.insert({ mapKey, s });
+
+    interval_tree::Interval<Spanner*> interval(s->tick().ticks(), s->tick2().ticks(), s);
+    m_tree.insert(interval);
+
+    SpannerEntry& entry = m_entries[s];
+    entry.groupKey = key;
+    entry.mapKey = mapKey;
+    entry.start = interval.start;
+
+    updateCollisionFreeInterval(it, group);
+    if (it != group.cbegin()) {
+        updateCollisionFreeInterval(std::prev(it), group);
+    }
+
+    ++m_stats.incrementalUpdates;
+}
+
+//---------------------------------------------------------
+//   removeFromTrees
+//---------------------------------------------------------
+
+void SpannerMap::removeFromTrees(Spanner* s) const
+{
+    auto entryIt = m_entries.find(s);
+    if (entryIt == m_entries.end()) {
+        m_dirty = true;
+        return;
+    }
+
+    const SpannerEntry entry = entryIt->second;
+    m_entries.erase(entryIt);
+
+    bool removed = m_tree.remove(entry.start, s);
+    if (entry.hasCollisionFreeInterval) {
+        removed = m_collisionFreeTree.remove(entry.start, s) && removed;
+    }
+
+    auto groupIt = m_groups.find(entry.groupKey);
+    if (!removed || groupIt == m_groups.end()) {
+        m_dirty = true;
+        return;
+    }
+
+    Group& group = groupIt->second;
+    auto range = group.equal_range(entry.mapKey);
+    auto it = std::find_if(range.first, range.second, [s](const auto& pair) { return pair.second == s; });
+    if (it == range.second) {
+        m_dirty = true;
+        return;
+    }
+
+    bool hasPrev = it != group.begin();
+    auto prevIt = hasPrev ? std::prev(it) : group.end();
+    group.erase(it);
+
+    if (hasPrev) {
+        updateCollisionFreeInterval(prevIt, group);
+    } else if (group.empty()) {
+        m_groups.erase(groupIt);
+    }
+
+    ++m_stats.incrementalUpdates;
+}
+
+//---------------------------------------------------------
+//   spannerTicksChanged
+//    the end of a spanner moved: only its own intervals
+//    have to be updated
+//---------------------------------------------------------
+
+void SpannerMap::spannerTicksChanged(Spanner* s) const
+{
+    if (m_dirty) {
+        return;
+    }
+
+    auto entryIt = m_entries.find(s);
+    if (entryIt == m_entries.end()) {
+        return;
+    }
+
+    if (moveToGroup(s)) {
+        return;
+    }
+
+    SpannerEntry& entry = entryIt->second;
+
+    auto groupIt = m_groups.find(entry.groupKey);
+    if (groupIt == m_groups.end() || !m_tree.remove(entry.start, s)) {
+        m_dirty = true;
+        return;
+    }
+
+    const Group& group = groupIt->second;
+    auto range = group.equal_range(entry.mapKey);
+    auto it = std::find_if(range.first, range.second, [s](const auto& pair) { return pair.second == s; });
+    if (it == range.second) {
+        m_dirty = true;
+        return;
+    }
+
+    if (entry.hasCollisionFreeInterval) {
+        m_collisionFreeTree.remove(entry.start, s);
+        entry.hasCollisionFreeInterval = false;
+    }
+
+    interval_tree::Interval<Spanner*> interval(s->tick().ticks(), s->tick2().ticks(), s);
+    m_tree.insert(interval);
+    entry.start = interval.start;
+
+    updateCollisionFreeInterval(it, group);
+
+    ++m_stats.incrementalUpdates;
+}
+
+//---------------------------------------------------------
+//   spannerTrackChanged
+//    the part of the spanner may have changed, so it may
+//    belong to another group now
+//---------------------------------------------------------
+
+void SpannerMap::spannerTrackChanged(Spanner* s) const
+{
+    if (m_dirty) {
+        return;
+    }
+
+    moveToGroup(s);
+}
+
+//---------------------------------------------------------
+//   moveToGroup
+//    moves the spanner to the group of its current part and
+//    type, returns false if it already is in that group
+//---------------------------------------------------------
+
+bool SpannerMap::moveToGroup(Spanner* s) const
+{
+    auto entryIt = m_entries.find(s);
+    if (entryIt == m_entries.end() || entryIt->second.groupKey == groupKey(s)) {
+        return false;
+    }
+
+    int mapKey = entryIt->second.mapKey;
+    removeFromTrees(s);
+    if (!m_dirty) {
+        addToTrees(s, mapKey);
+    }
+
+    return true;
 }
 
 //---------------------------------------------------------
@@ -68,10 +299,14 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
     m_results.clear();
 
+    auto collect = [this](const interval_tree::Interval<Spanner*>& interval) {
+        m_results.push_back(interval);
+    };
+
     if (excludeCollisions) {
-        m_results = m_collisionFreeTree.findContained(start, stop);
+        m_collisionFreeTree.visit_contained(start, stop, collect);
     } else {
-        m_results = m_tree.findContained(start, stop);
+        m_tree.visit_contained(start, stop, collect);
     }
 
     return m_results;
@@ -89,10 +324,14 @@ const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop,
 
     m_results.clear();
 
+    auto collect = [this](const interval_tree::Interval<Spanner*>& interval) {
+        m_results.push_back(interval);
+    };
+
     if (excludeCollisions) {
-        m_results = m_collisionFreeTree.findOverlapping(start, stop);
+        m_collisionFreeTree.visit_overlapping(start, stop, collect);
     } else {
-        m_results = m_tree.findOverlapping(start, stop);
+        m_tree.visit_overlapping(start, stop, collect);
     }
 
     return m_results;
@@ -100,50 +339,17 @@ const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop,
 
 void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const
 {
-    using IntervalsByType = std::map<ElementType, IntervalList>;
-    using IntervalsByPart = std::map<ID, IntervalsByType>;
-
-    IntervalsByPart intervalsByPart;
-
-    //!Note Because of the current UX of spanners adjustments spanners collision is a regular thing,
-    //!     so we have to manage those cases when two similar spanners (e.g. Pedal line) are overlapping
-    //!     with each other.
-    constexpr int collidingSpannersPadding = 1;
-
-    for (const auto& pair : *this) {
-        Spanner* spanner = pair.second;
-
-        int newSpannerStartTick = spanner->tick().ticks();
-        int newSpannerEndTick = spanner->tick2().ticks();
-
-        IntervalsByType& intervalsByType = intervalsByPart[spanner->part()->id()];
-        IntervalList& intervalList = intervalsByType[spanner->type()];
-
-        if (!intervalList.empty()) {
-            auto lastIntervalIt = intervalList.rbegin();
-            if (lastIntervalIt->stop >= newSpannerStartTick) {
-                if (!lastIntervalIt->value->isLinked(spanner)) {
-                    lastIntervalIt->stop = newSpannerStartTick - collidingSpannersPadding;
-                }
-            }
-        }
-
-        intervalList.emplace_back(interval_tree::Interval<Spanner*>(newSpannerStartTick,
-                                                                    newSpannerEndTick,
-                                                                    spanner));
-
-        regularIntervals.push_back(interval_tree::Interval(newSpannerStartTick,
-                                                           newSpannerEndTick,
-                                                           spanner));
+    if (m_dirty) {
+        update();
     }
 
-    for (const auto& pair : intervalsByPart) {
-        for (const auto& intervals : pair.second) {
-            collisionFreeIntervals.insert(collisionFreeIntervals.end(),
-                                          intervals.second.begin(),
-                                          intervals.second.end());
-        }
-    }
+    m_tree.visit_all([&](const interval_tree::Interval<Spanner*>& interval) {
+        regularIntervals.push_back(interval);
+    });
+
+    m_collisionFreeTree.visit_all([&](const interval_tree::Interval<Spanner*>& interval) {
+        collisionFreeIntervals.push_back(interval);
+    });
 }
 
 //---------------------------------------------------------
@@ -152,8 +358,12 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
 
 void SpannerMap::addSpanner(Spanner* s)
 {
-    insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    m_dirty = true;
+    int key = s->tick().ticks();
+    insert(std::pair<int, Spanner*>(key, s));
+
+    if (!m_dirty) {
+        addToTrees(s, key);
+    }
 }
 
 //---------------------------------------------------------
@@ -162,10 +372,25 @@ void SpannerMap::addSpanner(Spanner* s)
 
 bool SpannerMap::removeSpanner(Spanner* s)
 {
+    auto eraseSpanner = [this, s](iterator it) {
+        erase(it);
+        if (!m_dirty) {
+            removeFromTrees(s);
+        }
+    };
+
+    // fast path: the spanner is usually still stored under its current tick
+    auto range = equal_range(s->tick().ticks());
+    for (auto i = range.first; i != range.second; ++i) {
+        if (i->second == s) {
+            eraseSpanner(i);
+            return true;
+        }
+    }
+
     for (auto i = begin(); i != end(); ++i) {
         if (i->second == s) {
-            erase(i);
-            m_dirty = true;
+            eraseSpanner(i);
             return true;
         }
     }
@@ -173,6 +398,20 @@ bool SpannerMap::removeSpanner(Spanner* s)
     return false;
 }
 
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpannerMap::clear()
+{
+    std::multimap<int, Spanner*>::clear();
+    m_tree.clear();
+    m_collisionFreeTree.clear();
+    m_groups.clear();
+    m_entries.clear();
+    m_dirty = true;
+}
+
 #ifndef NDEBUG
 //---------------------------------------------------------
 //   dump
@@ -24,8 +24,10 @@
 #define MU_ENGRAVING_SPANNERMAP_H
 
 #include <map>
+#include <unordered_map>
 
-#include "thirdparty/intervaltree/IntervalTree.h"
+#include "infrastructure/dynamicintervaltree.h"
+#include "types/types.h"
 
 namespace mu::engraving {
 class Spanner;
@@ -42,6 +44,12 @@ public:
 
     using IntervalList = std::vector<interval_tree::Interval<Spanner*> >;
 
+    // counters to measure how often the lookup trees are rebuilt from scratch
+    struct Stats {
+        size_t fullRebuilds = 0;
+        size_t incrementalUpdates = 0;
+    };
+
     SpannerMap();
 
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
@@ -56,20 +64,45 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); m_dirty = true; }
+    void clear();
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
-    void setDirty() const { m_dirty = true; }     // must be called if a spanner changes start/length
+    void setDirty() const { m_dirty = true; }     // must be called if a spanner changes start
+    void spannerTicksChanged(Spanner* s) const;   // must be called if a spanner changes length only
+    void spannerTrackChanged(Spanner* s) const;   // must be called if a spanner changes track
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats() const { m_stats = Stats(); }
+
 #ifndef NDEBUG
     void dump() const;
 #endif
 
 private:
+    using GroupKey = std::pair<ID, ElementType>;
+    using Group = std::multimap<int, Spanner*>;
+
+    struct SpannerEntry {
+        GroupKey groupKey;
+        int mapKey = 0;
+        int start = 0;
+        bool hasCollisionFreeInterval = false;
+    };
+
+    static GroupKey groupKey(const Spanner* s);
+
+    void addToTrees(Spanner* s, int mapKey) const;
+    void removeFromTrees(Spanner* s) const;
+    bool moveToGroup(Spanner* s) const;
+    void updateCollisionFreeInterval(Group::const_iterator it, const Group& group) const;
 
     mutable bool m_dirty = false;
-    mutable interval_tree::IntervalTree<Spanner*> m_tree;
-    mutable interval_tree::IntervalTree<Spanner*> m_collisionFreeTree;
+    mutable DynamicIntervalTree<Spanner*> m_tree;
+    mutable DynamicIntervalTree<Spanner*> m_collisionFreeTree;
+    mutable std::map<GroupKey, Group> m_groups;
+    mutable std::unordered_map<const Spanner*, SpannerEntry> m_entries;
     mutable std::vector<interval_tree::Interval<Spanner*> > m_results;
+    mutable Stats m_stats;
 };
 } // namespace mu::engraving
 
@@ -113,6 +113,8 @@ void TextBase::startEdit(EditData& ed)
 
     ted->oldXmlText = xmlText();
     ted->startUndoIdx = score()->undoStack()->getCurIdx();
+    // the commands of the edit and the one adding the text are merged in endEdit()
+    score()->undoStack()->setReleaseFloor(ted->startUndoIdx > 0 ? ted->startUndoIdx - 1 : 0);
 
     const LayoutData* ldata = this->ldata();
     if (!ldata || ldata->layoutInvalid) {
@@ -145,6 +147,8 @@ void TextBase::endEdit(EditData& ed)
         return;
     }
 
+    undo->setReleaseFloor(mu::nidx);
+
     const String actualXmlText = xmlText();
     const String actualPlainText = plainText();
 
@@ -121,6 +121,7 @@ enum class CommandType {
 
     // Property
     ChangeProperty,
+    ChangeProperties,
 
     // Voices
     ExchangeVoice,
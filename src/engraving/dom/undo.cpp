@@ -160,6 +160,25 @@ static void updateStaffTextCache(const StaffTextBase* text, Score* score)
     }
 }
 
+//---------------------------------------------------------
+//   estimatedMemoryUsage
+//    rough estimate of the memory held by an element tree
+//---------------------------------------------------------
+
+static size_t estimatedMemoryUsage(const EngravingObject* object)
+{
+    if (!object) {
+        return 0;
+    }
+
+    size_t result = sizeof(EngravingItem);
+    for (const EngravingObject* child : object->scanChildren()) {
+        result += estimatedMemoryUsage(child);
+    }
+
+    return result;
+}
+
 //---------------------------------------------------------
 //   UndoCommand
 //---------------------------------------------------------
@@ -182,6 +201,19 @@ void UndoCommand::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   UndoCommand::memoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    size_t result = sizeof(UndoCommand);
+    for (const UndoCommand* c : childList) {
+        result += c->memoryUsage();
+    }
+    return result;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -308,7 +340,10 @@ UndoStack::~UndoStack()
 {
     size_t idx = 0;
     for (auto c : list) {
-        c->cleanup(idx++ < curIdx);
+        if (c) {
+            c->cleanup(idx < curIdx);
+        }
+        ++idx;
     }
     DeleteAll(list);
 }
@@ -391,10 +426,12 @@ void UndoStack::remove(size_t idx)
 {
     assert(idx <= curIdx);
     assert(curIdx != mu::nidx);
+    idx = std::max(idx, firstIdx);
     // remove redo stack
     while (list.size() > curIdx) {
         UndoCommand* cmd = mu::takeLast(list);
         stateList.pop_back();
+        totalSize -= mu::takeLast(sizeList);
         cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
         delete cmd;
 //            --curIdx;
@@ -402,12 +439,48 @@ void UndoStack::remove(size_t idx)
     while (list.size() > idx) {
         UndoCommand* cmd = mu::takeLast(list);
         stateList.pop_back();
+        totalSize -= mu::takeLast(sizeList);
         cmd->cleanup(true);
         delete cmd;
     }
     curIdx = idx;
 }
 
+//---------------------------------------------------------
+//   releaseOldMacros
+//    free the oldest macros while the history holds more
+//    memory than allowed by MScore::undoMemoryBudget.
+//    Released macros stay in the list as null entries, so
+//    undo indices stored elsewhere remain valid.
+//    Macros from floor on are never released.
+//---------------------------------------------------------
+
+void UndoStack::releaseOldMacros(size_t floor)
+{
+    if (MScore::undoMemoryBudget == 0) {
+        return;
+    }
+
+    const size_t oldFirstIdx = firstIdx;
+
+    // always keep the most recent macro
+    while (totalSize > MScore::undoMemoryBudget && firstIdx + 1 < curIdx && firstIdx < floor) {
+        UndoMacro* macro = list[firstIdx];
+        macro->cleanup(true);
+        delete macro;
+        list[firstIdx] = nullptr;
+
+        totalSize -= sizeList[firstIdx];
+        sizeList[firstIdx] = 0;
+        ++firstIdx;
+    }
+
+    if (firstIdx != oldFirstIdx) {
+        LOGI() << "released " << (firstIdx - oldFirstIdx) << " undo macros, the undo history now holds "
+               << totalSize / 1024 << " KB (budget " << MScore::undoMemoryBudget / 1024 << " KB)";
+    }
+}
+
 //---------------------------------------------------------
 //   mergeCommands
 //---------------------------------------------------------
@@ -416,6 +489,11 @@ void UndoStack::mergeCommands(size_t startIdx)
 {
     assert(startIdx <= curIdx);
 
+    // released macros can't be merged, see setReleaseFloor()
+    IF_ASSERT_FAILED(startIdx >= firstIdx) {
+        return;
+    }
+
     if (startIdx >= list.size()) {
         return;
     }
@@ -424,6 +502,8 @@ void UndoStack::mergeCommands(size_t startIdx)
 
     for (size_t idx = startIdx + 1; idx < curIdx; ++idx) {
         startMacro->append(std::move(*list[idx]));
+        sizeList[startIdx] += sizeList[idx];
+        sizeList[idx] = 0;
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
 }
@@ -441,6 +521,9 @@ void UndoStack::pop()
         return;
     }
     UndoCommand* cmd = curCmd->removeChild();
+    if (cmd == propertyBatch) {
+        propertyBatch = nullptr;
+    }
     cmd->undo(0);
 }
 
@@ -458,6 +541,8 @@ void UndoStack::endMacro(bool rollback)
         LOGW("not active");
         return;
     }
+    propertyBatch = nullptr;
+
     if (rollback) {
         delete curCmd;
     } else {
@@ -465,16 +550,74 @@ void UndoStack::endMacro(bool rollback)
         while (list.size() > curIdx) {
             UndoCommand* cmd = mu::takeLast(list);
             stateList.pop_back();
+            totalSize -= mu::takeLast(sizeList);
             cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
             delete cmd;
         }
+        size_t size = curCmd->memoryUsage();
         list.push_back(curCmd);
         stateList.push_back(nextState++);
+        sizeList.push_back(size);
+        totalSize += size;
         ++curIdx;
+
+        releaseOldMacros(releaseFloor);
     }
     curCmd = 0;
 }
 
+//---------------------------------------------------------
+//   beginPropertyBatch
+//    Property changes made through undoChangeProperty()
+//    until the matching endPropertyBatch() are collected
+//    into a single ChangeProperties command instead of one
+//    ChangeProperty per element and linked copy.
+//    Batches may be nested; only the outermost counts.
+//---------------------------------------------------------
+
+void UndoStack::beginPropertyBatch()
+{
+    ++propertyBatchLevel;
+}
+
+//---------------------------------------------------------
+//   endPropertyBatch
+//---------------------------------------------------------
+
+void UndoStack::endPropertyBatch()
+{
+    IF_ASSERT_FAILED(propertyBatchLevel > 0) {
+        return;
+    }
+
+    if (--propertyBatchLevel == 0) {
+        propertyBatch = nullptr;
+    }
+}
+
+//---------------------------------------------------------
+//   currentPropertyBatch
+//    Return the batch collecting property changes, or
+//    nullptr if batching is not active. As long as no other
+//    command is pushed, consecutive property changes end up
+//    in the same batch; otherwise a new one is started, so
+//    the order of commands in the macro is preserved.
+//---------------------------------------------------------
+
+ChangeProperties* UndoStack::currentPropertyBatch()
+{
+    if (propertyBatchLevel == 0 || !curCmd) {
+        return nullptr;
+    }
+
+    if (!propertyBatch || curCmd->commands().empty() || curCmd->commands().back() != propertyBatch) {
+        propertyBatch = new ChangeProperties();
+        curCmd->appendChild(propertyBatch);
+    }
+
+    return propertyBatch;
+}
+
 //---------------------------------------------------------
 //   reopen
 //---------------------------------------------------------
@@ -487,10 +630,11 @@ void UndoStack::reopen()
 
     LOG_UNDO() << "curIdx: " << curIdx << ", size: " << list.size();
     assert(curCmd == 0);
-    assert(curIdx > 0);
+    assert(curIdx > firstIdx);
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
     stateList.erase(stateList.begin() + curIdx);
+    totalSize -= mu::takeAt(sizeList, curIdx);
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
     }
@@ -511,7 +655,7 @@ void UndoStack::undo(EditData* ed)
             return;
         }
     }
-    if (curIdx) {
+    if (curIdx > firstIdx) {
         --curIdx;
         assert(curIdx < list.size());
         list[curIdx]->undo(ed);
@@ -655,6 +799,11 @@ UndoMacro::ChangesInfo UndoMacro::changesInfo() const
         if (type == CommandType::ChangeProperty) {
             auto changeProperty = static_cast<const ChangeProperty*>(command);
             result.changedPropertyIdSet.insert(changeProperty->getId());
+        } else if (type == CommandType::ChangeProperties) {
+            auto changeProperties = static_cast<const ChangeProperties*>(command);
+            for (Pid id : changeProperties->propertyIds()) {
+                result.changedPropertyIdSet.insert(id);
+            }
         } else if (type == CommandType::ChangeStyleVal) {
             auto changeStyle = static_cast<const ChangeStyleVal*>(command);
             result.changedStyleIdSet.insert(changeStyle->id());
@@ -1078,6 +1227,20 @@ void RemoveElement::redo(EditData*)
 //   name
 //---------------------------------------------------------
 
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t RemoveElement::memoryUsage() const
+{
+    // the removed element is owned by the command while it is not undone
+    return sizeof(RemoveElement) + estimatedMemoryUsage(element);
+}
+
+//---------------------------------------------------------
+//   name
+//---------------------------------------------------------
+
 const char* RemoveElement::name() const
 {
     static char buffer[64];
@@ -2181,6 +2344,22 @@ void InsertRemoveMeasures::insertMeasures()
     }
 }
 
+//---------------------------------------------------------
+//   RemoveMeasures::memoryUsage
+//---------------------------------------------------------
+
+size_t RemoveMeasures::memoryUsage() const
+{
+    size_t result = sizeof(RemoveMeasures);
+    for (const MeasureBase* mb = fm; mb; mb = mb->next()) {
+        result += estimatedMemoryUsage(mb);
+        if (mb == lm) {
+            break;
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------
 //   removeMeasures
 //---------------------------------------------------------
@@ -2553,14 +2732,12 @@ void ChangeClefType::flip(EditData*)
 }
 
 //---------------------------------------------------------
-//   ChangeProperty::flip
+//   flipProperty
 //---------------------------------------------------------
 
-void ChangeProperty::flip(EditData*)
+static void flipProperty(EngravingObject* element, Pid id, PropertyValue& property, PropertyFlags& flags)
 {
-    LOG_UNDO() << element->typeName() << int(id) << "(" << propertyName(id) << ")" << element->getProperty(id) << "->" << property;
-
-    PropertyValue v       = element->getProperty(id);
+    PropertyValue v  = element->getProperty(id);
     PropertyFlags ps = element->propertyFlags(id);
 
     element->setProperty(id, property);
@@ -2574,11 +2751,85 @@ void ChangeProperty::flip(EditData*)
     flags = ps;
 }
 
+//---------------------------------------------------------
+//   ChangeProperty::flip
+//---------------------------------------------------------
+
+void ChangeProperty::flip(EditData*)
+{
+    LOG_UNDO() << element->typeName() << int(id) << "(" << propertyName(id) << ")" << element->getProperty(id) << "->" << property;
+
+    flipProperty(element, id, property, flags);
+}
+
 std::vector<const EngravingObject*> ChangeProperty::objectItems() const
 {
     return compoundObjects(element);
 }
 
+//---------------------------------------------------------
+//   ChangeProperties
+//---------------------------------------------------------
+
+void ChangeProperties::applyChange(EngravingObject* e, Pid id, const PropertyValue& v, PropertyFlags ps)
+{
+    LOG_UNDO() << e->typeName() << int(id) << "(" << propertyName(id) << ")" << e->getProperty(id) << "->" << v;
+
+    Change change { e, id, v, ps };
+    flipProperty(change.element, change.id, change.property, change.flags);
+    m_changes.push_back(std::move(change));
+}
+
+void ChangeProperties::undo(EditData*)
+{
+    for (auto it = m_changes.rbegin(); it != m_changes.rend(); ++it) {
+        flipProperty(it->element, it->id, it->property, it->flags);
+    }
+}
+
+void ChangeProperties::redo(EditData*)
+{
+    for (Change& change : m_changes) {
+        flipProperty(change.element, change.id, change.property, change.flags);
+    }
+}
+
+std::vector<Pid> ChangeProperties::propertyIds() const
+{
+    std::vector<Pid> ids;
+    ids.reserve(m_changes.size());
+    for (const Change& change : m_changes) {
+        ids.push_back(change.id);
+    }
+    return ids;
+}
+
+std::vector<const EngravingObject*> ChangeProperties::objectItems() const
+{
+    std::vector<const EngravingObject*> result;
+    for (const Change& change : m_changes) {
+        for (const EngravingObject* obj : compoundObjects(change.element)) {
+            result.push_back(obj);
+        }
+    }
+    return result;
+}
+
+bool ChangeProperties::isFiltered(UndoCommand::Filter f, const EngravingItem* target) const
+{
+    if (f != UndoCommand::Filter::ChangePropertyLinked || m_changes.empty()) {
+        return false;
+    }
+
+    const std::list<EngravingObject*> links = target->linkList();
+    for (const Change& change : m_changes) {
+        if (!mu::contains(links, change.element)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
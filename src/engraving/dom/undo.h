@@ -68,6 +68,7 @@
 
 namespace mu::engraving {
 class Bend;
+class ChangeProperties;
 class Chord;
 class ChordRest;
 class Clef;
@@ -131,6 +132,7 @@ public:
     const std::list<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
+    virtual size_t memoryUsage() const;   // estimated bytes retained by this command in the "done" state
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
@@ -201,14 +203,21 @@ private:
 class UndoStack
 {
     UndoMacro* curCmd = nullptr;
+    ChangeProperties* propertyBatch = nullptr;     // last child of curCmd which collects property changes
+    int propertyBatchLevel = 0;
     std::vector<UndoMacro*> list;
     std::vector<int> stateList;
+    std::vector<size_t> sizeList;       // estimated memory usage of each macro in list
     int nextState = 0;
     int cleanState = 0;
     size_t curIdx = 0;
+    size_t firstIdx = 0;                // macros before firstIdx were released and can't be undone
+    size_t releaseFloor = mu::nidx;     // macros from releaseFloor on are never released, see setReleaseFloor()
+    size_t totalSize = 0;
     bool isLocked = false;
 
     void remove(size_t idx);
+    void releaseOldMacros(size_t floor);
 
 public:
     UndoStack();
@@ -222,19 +231,30 @@ public:
     void push(UndoCommand*, EditData*);        // push & execute
     void push1(UndoCommand*);
     void pop();
-    bool canUndo() const { return curIdx > 0; }
+    bool canUndo() const { return curIdx > firstIdx; }
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
     size_t getCurIdx() const { return curIdx; }
     UndoMacro* current() const { return curCmd; }
-    UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
-    UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
+    UndoMacro* last() const { return curIdx > firstIdx ? list[curIdx - 1] : 0; }
+    UndoMacro* prev() const { return curIdx > firstIdx + 1 ? list[curIdx - 2] : 0; }
     void undo(EditData*);
     void redo(EditData*);
     void reopen();
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE Keeps the macros from idx on while they may still be merged (e.g. during text editing),
+    //! whatever the memory budget; mu::nidx removes the floor
+    void setReleaseFloor(size_t idx) { releaseFloor = idx; }
+
+    void beginPropertyBatch();
+    void endPropertyBatch();
+    ChangeProperties* currentPropertyBatch();
+
+    size_t memoryUsage() const { return totalSize; }
+    size_t releasedCount() const { return firstIdx; }
 };
 
 class InsertPart : public UndoCommand
@@ -660,6 +680,7 @@ public:
     void undo(EditData*) override;
     void redo(EditData*) override;
     void cleanup(bool) override;
+    size_t memoryUsage() const override;
     const char* name() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
@@ -788,6 +809,7 @@ class ChangeStyle : public UndoCommand
 
 public:
     ChangeStyle(Score*, const MStyle&, const bool overlapOnly = false);
+    size_t memoryUsage() const override { return sizeof(ChangeStyle); }
 
     UNDO_TYPE(CommandType::ChangeStyle)
     UNDO_NAME("ChangeStyle")
@@ -890,12 +912,12 @@ class InsertRemoveMeasures : public UndoCommand
 {
     OBJECT_ALLOCATOR(engraving, InsertRemoveMeasures)
 
-    MeasureBase* fm = nullptr;
-    MeasureBase* lm = nullptr;
-
     static std::vector<Clef*> getCourtesyClefs(Measure* m);
 
 protected:
+    MeasureBase* fm = nullptr;
+    MeasureBase* lm = nullptr;
+
     void removeMeasures();
     void insertMeasures();
 
@@ -915,6 +937,7 @@ public:
         : InsertRemoveMeasures(m1, m2) {}
     void undo(EditData*) override { insertMeasures(); }
     void redo(EditData*) override { removeMeasures(); }
+    size_t memoryUsage() const override;
 
     UNDO_TYPE(CommandType::RemoveMeasures)
     UNDO_NAME("RemoveMeasures")
@@ -1128,6 +1151,8 @@ public:
     EngravingObject* getElement() const { return element; }
     PropertyValue data() const { return property; }
 
+    size_t memoryUsage() const override { return sizeof(ChangeProperty); }
+
     UNDO_TYPE(CommandType::ChangeProperty)
     UNDO_NAME("ChangeProperty")
 
@@ -1167,6 +1192,49 @@ public:
     UNDO_NAME("ChangeTextLineProperty")
 };
 
+//---------------------------------------------------------
+//   ChangeProperties
+//    A batch of property changes, typically one property
+//    propagated to all linked copies of an element.
+//    Changes are applied as they are added, so the batch
+//    is only undone/redone as a whole.
+//---------------------------------------------------------
+
+class ChangeProperties : public UndoCommand
+{
+    OBJECT_ALLOCATOR(engraving, ChangeProperties)
+
+    struct Change {
+        EngravingObject* element = nullptr;
+        Pid id = Pid::END;
+        PropertyValue property;
+        PropertyFlags flags = PropertyFlags::NOSTYLE;
+    };
+
+    std::vector<Change> m_changes;
+
+public:
+    ChangeProperties() = default;
+
+    void applyChange(EngravingObject* e, Pid id, const PropertyValue& v, PropertyFlags ps);
+
+    void undo(EditData*) override;
+    void redo(EditData*) override;
+
+    bool empty() const { return m_changes.empty(); }
+    size_t size() const { return m_changes.size(); }
+    std::vector<Pid> propertyIds() const;
+
+    size_t memoryUsage() const override { return sizeof(ChangeProperties) + m_changes.capacity() * sizeof(Change); }
+
+    UNDO_TYPE(CommandType::ChangeProperties)
+    UNDO_NAME("ChangeProperties")
+
+    std::vector<const EngravingObject*> objectItems() const override;
+
+    bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
+};
+
 class ChangeMetaText : public UndoCommand
 {
     OBJECT_ALLOCATOR(engraving, ChangeMetaText)
@@ -53,6 +53,7 @@ public:
     virtual void draw(SymId id, draw::Painter* p, const SizeF& mag, const PointF& pos) const = 0;
     virtual void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const = 0;
     virtual void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const = 0;
+    virtual void draw(const SymIdList& ids, const std::vector<PointF>& positions, draw::Painter* p, const SizeF& mag) const = 0;
 };
 
 using IEngravingFontPtr = std::shared_ptr<IEngravingFont>;
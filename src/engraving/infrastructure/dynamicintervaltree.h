@@ -0,0 +1,306 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_DYNAMICINTERVALTREE_H
+#define MU_ENGRAVING_DYNAMICINTERVALTREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "thirdparty/intervaltree/IntervalTree.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   DynamicIntervalTree
+//    Interval tree which supports insertion and removal
+//    of single intervals in O(log n), without rebuilding.
+//    Implemented as a treap ordered by interval start,
+//    where every node also stores the maximum stop of its
+//    subtree. Intervals with equal start keep insertion order.
+//---------------------------------------------------------
+
+template<typename Value, class Scalar = int>
+class DynamicIntervalTree
+{
+public:
+    using interval = interval_tree::Interval<Value, Scalar>;
+    using interval_vector = std::vector<interval>;
+
+    DynamicIntervalTree() = default;
+    DynamicIntervalTree(DynamicIntervalTree&&) = default;
+    DynamicIntervalTree& operator=(DynamicIntervalTree&&) = default;
+
+    DynamicIntervalTree(const DynamicIntervalTree& other)
+        : m_root(clone(other.m_root)), m_size(other.m_size), m_seed(other.m_seed) {}
+
+    DynamicIntervalTree& operator=(const DynamicIntervalTree& other)
+    {
+        m_root = clone(other.m_root);
+        m_size = other.m_size;
+        m_seed = other.m_seed;
+        return *this;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void clear()
+    {
+        m_root.reset();
+        m_size = 0;
+    }
+
+    void insert(const interval& i)
+    {
+        NodePtr node = std::make_unique<Node>(i, nextPriority());
+        m_root = insert(std::move(m_root), std::move(node));
+        ++m_size;
+    }
+
+    //! Removes the first interval with the given start holding the given value
+    bool remove(const Scalar& start, const Value& value)
+    {
+        bool removed = false;
+        m_root = remove(std::move(m_root), start, value, removed);
+        if (removed) {
+            --m_size;
+        }
+        return removed;
+    }
+
+    // Call f on all intervals overlapping [start, stop], in order of their start
+    template<class UnaryFunction>
+    void visit_overlapping(const Scalar& start, const Scalar& stop, UnaryFunction f) const
+    {
+        visitOverlapping(m_root.get(), start, stop, f);
+    }
+
+    // Call f on all intervals contained within [start, stop], in order of their start
+    template<class UnaryFunction>
+    void visit_contained(const Scalar& start, const Scalar& stop, UnaryFunction f) const
+    {
+        auto filterF = [&](const interval& i) {
+            if (start <= i.start && i.stop <= stop) {
+                f(i);
+            }
+        };
+        visitOverlapping(m_root.get(), start, stop, filterF);
+    }
+
+    // Call f on all intervals, in order of their start
+    template<class UnaryFunction>
+    void visit_all(UnaryFunction f) const
+    {
+        visitAll(m_root.get(), f);
+    }
+
+    interval_vector findOverlapping(const Scalar& start, const Scalar& stop) const
+    {
+        interval_vector result;
+        visit_overlapping(start, stop, [&](const interval& i) { result.push_back(i); });
+        return result;
+    }
+
+    interval_vector findContained(const Scalar& start, const Scalar& stop) const
+    {
+        interval_vector result;
+        visit_contained(start, stop, [&](const interval& i) { result.push_back(i); });
+        return result;
+    }
+
+private:
+    struct Node;
+    using NodePtr = std::unique_ptr<Node>;
+
+    struct Node {
+        interval value;
+        Scalar maxStop;
+        uint32_t priority = 0;
+        NodePtr left;
+        NodePtr right;
+
+        Node(const interval& i, uint32_t p)
+            : value(i), maxStop(i.stop), priority(p) {}
+    };
+
+    static void updateMaxStop(Node* node)
+    {
+        node->maxStop = node->value.stop;
+        if (node->left) {
+            node->maxStop = std::max(node->maxStop, node->left->maxStop);
+        }
+        if (node->right) {
+            node->maxStop = std::max(node->maxStop, node->right->maxStop);
+        }
+    }
+
+    static NodePtr rotateRight(NodePtr node)
+    {
+        NodePtr left = std::move(node->left);
+        node->left = std::move(left->right);
+        updateMaxStop(node.get());
+        left->right = std::move(node);
+        updateMaxStop(left.get());
+        return left;
+    }
+
+    static NodePtr rotateLeft(NodePtr node)
+    {
+        NodePtr right = std::move(node->right);
+        node->right = std::move(right->left);
+        updateMaxStop(node.get());
+        right->left = std::move(node);
+        updateMaxStop(right.get());
+        return right;
+    }
+
+    static NodePtr insert(NodePtr root, NodePtr node)
+    {
+        if (!root) {
+            return node;
+        }
+
+        if (node->value.start < root->value.start) {
+            root->left = insert(std::move(root->left), std::move(node));
+            if (root->left->priority > root->priority) {
+                return rotateRight(std::move(root));
+            }
+        } else {
+            root->right = insert(std::move(root->right), std::move(node));
+            if (root->right->priority > root->priority) {
+                return rotateLeft(std::move(root));
+            }
+        }
+
+        updateMaxStop(root.get());
+        return root;
+    }
+
+    static NodePtr merge(NodePtr left, NodePtr right)
+    {
+        if (!left) {
+            return right;
+        }
+        if (!right) {
+            return left;
+        }
+
+        if (left->priority > right->priority) {
+            left->right = merge(std::move(left->right), std::move(right));
+            updateMaxStop(left.get());
+            return left;
+        }
+
+        right->left = merge(std::move(left), std::move(right->left));
+        updateMaxStop(right.get());
+        return right;
+    }
+
+    static NodePtr remove(NodePtr root, const Scalar& start, const Value& value, bool& removed)
+    {
+        if (!root) {
+            return root;
+        }
+
+        if (start < root->value.start) {
+            root->left = remove(std::move(root->left), start, value, removed);
+        } else if (root->value.start < start) {
+            root->right = remove(std::move(root->right), start, value, removed);
+        } else {
+            // intervals with an equal start may live on both sides
+            root->left = remove(std::move(root->left), start, value, removed);
+            if (!removed && root->value.value == value) {
+                removed = true;
+                return merge(std::move(root->left), std::move(root->right));
+            }
+            if (!removed) {
+                root->right = remove(std::move(root->right), start, value, removed);
+            }
+        }
+
+        updateMaxStop(root.get());
+        return root;
+    }
+
+    template<class UnaryFunction>
+    static void visitOverlapping(const Node* node, const Scalar& start, const Scalar& stop, UnaryFunction& f)
+    {
+        if (!node || node->maxStop < start) {
+            return;
+        }
+
+        visitOverlapping(node->left.get(), start, stop, f);
+
+        if (stop < node->value.start) {
+            return;
+        }
+
+        if (start <= node->value.stop) {
+            f(node->value);
+        }
+
+        visitOverlapping(node->right.get(), start, stop, f);
+    }
+
+    template<class UnaryFunction>
+    static void visitAll(const Node* node, UnaryFunction& f)
+    {
+        if (!node) {
+            return;
+        }
+
+        visitAll(node->left.get(), f);
+        f(node->value);
+        visitAll(node->right.get(), f);
+    }
+
+    static NodePtr clone(const NodePtr& node)
+    {
+        if (!node) {
+            return nullptr;
+        }
+
+        NodePtr copy = std::make_unique<Node>(node->value, node->priority);
+        copy->maxStop = node->maxStop;
+        copy->left = clone(node->left);
+        copy->right = clone(node->right);
+        return copy;
+    }
+
+    uint32_t nextPriority()
+    {
+        // xorshift: deterministic, so that the tree shape doesn't differ between runs
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 17;
+        m_seed ^= m_seed << 5;
+        return m_seed;
+    }
+
+    NodePtr m_root;
+    size_t m_size = 0;
+    uint32_t m_seed = 2463534242;
+};
+}
+
+#endif // MU_ENGRAVING_DYNAMICINTERVALTREE_H
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "eidregister.h"
+
+#include "dom/engravingobject.h"
+
+using namespace mu::engraving;
+
+void EIDRegister::registerItem(EngravingObject* item)
+{
+    const EID eid = item->eid();
+    if (!eid.isValid()) {
+        return;
+    }
+
+    m_items[eid.toUint64()] = item;
+}
+
+void EIDRegister::unregisterItem(const EngravingObject* item)
+{
+    const EID eid = item->eid();
+    if (!eid.isValid()) {
+        return;
+    }
+
+    // the same EID may have been taken over by another object (e.g. on read)
+    auto it = m_items.find(eid.toUint64());
+    if (it != m_items.end() && it->second == item) {
+        m_items.erase(it);
+    }
+}
+
+void EIDRegister::unregisterItemsOf(const Score* score)
+{
+    for (auto it = m_items.begin(); it != m_items.end();) {
+        if (it->second->score() == score) {
+            it = m_items.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+EngravingObject* EIDRegister::itemFromEID(const EID& eid) const
+{
+    if (!eid.isValid()) {
+        return nullptr;
+    }
+
+    auto it = m_items.find(eid.toUint64());
+    return it != m_items.end() ? it->second : nullptr;
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_EIDREGISTER_H
+#define MU_ENGRAVING_EIDREGISTER_H
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "eid.h"
+
+namespace mu::engraving {
+class EngravingObject;
+class Score;
+
+//---------------------------------------------------------
+//   EIDRegister
+//    Index of all living objects of a master score
+//    (including its parts) by their EID.
+//    Objects register themselves when they get an EID
+//    and unregister when they are destroyed, so the index
+//    also contains objects which are currently only held
+//    by the undo stack.
+//---------------------------------------------------------
+
+class EIDRegister
+{
+public:
+    EIDRegister() = default;
+
+    void registerItem(EngravingObject* item);
+    void unregisterItem(const EngravingObject* item);
+    void unregisterItemsOf(const Score* score);
+
+    EngravingObject* itemFromEID(const EID& eid) const;
+
+    size_t size() const { return m_items.size(); }
+    void clear() { m_items.clear(); }
+
+private:
+    EIDRegister(const EIDRegister&) = delete;
+
+    std::unordered_map<uint64_t, EngravingObject*> m_items;
+};
+}
+
+#endif // MU_ENGRAVING_EIDREGISTER_H
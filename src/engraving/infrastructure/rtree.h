@@ -0,0 +1,386 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_RTREE_H
+#define MU_ENGRAVING_RTREE_H
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   RTree
+//    Spatial index of values by their bounding rects.
+//    Values are inserted, moved and removed one by one,
+//    so the index does not need to be rebuilt after a change.
+//    Nodes are split quadratically (Guttman); on removal
+//    emptied nodes are dropped, underfull ones are kept.
+//---------------------------------------------------------
+
+template<typename Value>
+class RTree
+{
+public:
+    RTree() = default;
+    RTree(const RTree&) = delete;
+    RTree& operator=(const RTree&) = delete;
+
+    size_t size() const { return m_leaves.size(); }
+    bool empty() const { return m_leaves.empty(); }
+    bool contains(const Value& value) const { return m_leaves.find(value) != m_leaves.cend(); }
+
+    void clear()
+    {
+        m_root.reset();
+        m_leaves.clear();
+    }
+
+    void insert(const Value& value, const RectF& rect)
+    {
+        if (contains(value)) {
+            update(value, rect);
+            return;
+        }
+
+        if (!m_root) {
+            m_root = std::make_unique<Node>();
+        }
+
+        Node* leaf = chooseLeaf(rect);
+        leaf->entries.push_back({ rect, value });
+        m_leaves[value] = leaf;
+
+        if (leaf->entries.size() > MAX_ENTRIES) {
+            split(leaf);
+        } else {
+            updateRects(leaf);
+        }
+    }
+
+    bool remove(const Value& value)
+    {
+        auto it = m_leaves.find(value);
+        if (it == m_leaves.end()) {
+            return false;
+        }
+
+        Node* leaf = it->second;
+        m_leaves.erase(it);
+
+        auto entry = std::find_if(leaf->entries.begin(), leaf->entries.end(), [&value](const Entry& e) { return e.value == value; });
+        leaf->entries.erase(entry);
+
+        Node* node = leaf;
+        while (node->isEmpty() && node->parent) {
+            Node* parent = node->parent;
+            auto child = std::find_if(parent->children.begin(), parent->children.end(), [node](const std::unique_ptr<Node>& n) {
+                return n.get() == node;
+            });
+            parent->children.erase(child);
+            node = parent;
+        }
+
+        if (node->isEmpty()) {
+            m_root.reset();
+            return true;
+        }
+
+        updateRects(node);
+        return true;
+    }
+
+    //! NOTE Returns true if the rect of the value was changed
+    bool update(const Value& value, const RectF& rect)
+    {
+        auto it = m_leaves.find(value);
+        if (it != m_leaves.end()) {
+            const Node* leaf = it->second;
+            for (const Entry& e : leaf->entries) {
+                if (e.value == value) {
+                    if (e.rect == rect) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+
+            remove(value);
+        }
+
+        insert(value, rect);
+        return true;
+    }
+
+    //! NOTE Calls func(value, rect) for every value whose rect overlaps the given one, edges included
+    template<typename Func>
+    void forEachIntersecting(const RectF& rect, Func func) const
+    {
+        if (!m_root) {
+            return;
+        }
+
+        std::vector<const Node*> stack { m_root.get() };
+        while (!stack.empty()) {
+            const Node* node = stack.back();
+            stack.pop_back();
+
+            if (node->isLeaf) {
+                for (const Entry& e : node->entries) {
+                    if (overlaps(e.rect, rect)) {
+                        func(e.value, e.rect);
+                    }
+                }
+                continue;
+            }
+
+            for (const std::unique_ptr<Node>& child : node->children) {
+                if (overlaps(child->rect, rect)) {
+                    stack.push_back(child.get());
+                }
+            }
+        }
+    }
+
+    template<typename Func>
+    void forEach(Func func) const
+    {
+        for (const auto& pair : m_leaves) {
+            func(pair.first);
+        }
+    }
+
+private:
+    static constexpr size_t MAX_ENTRIES = 16;
+    static constexpr size_t MIN_ENTRIES = 4;
+
+    struct Entry {
+        RectF rect;
+        Value value;
+    };
+
+    struct Node {
+        Node* parent = nullptr;
+        bool isLeaf = true;
+        RectF rect;
+        std::vector<Entry> entries;                     // if leaf
+        std::vector<std::unique_ptr<Node> > children;   // otherwise
+
+        bool isEmpty() const { return isLeaf ? entries.empty() : children.empty(); }
+        size_t count() const { return isLeaf ? entries.size() : children.size(); }
+    };
+
+    static bool overlaps(const RectF& a, const RectF& b)
+    {
+        return a.left() <= b.right() && b.left() <= a.right() && a.top() <= b.bottom() && b.top() <= a.bottom();
+    }
+
+    //! NOTE Unlike RectF::united, empty rects are not ignored
+    static RectF bound(const RectF& a, const RectF& b)
+    {
+        double left = std::min(a.left(), b.left());
+        double top = std::min(a.top(), b.top());
+        double right = std::max(a.right(), b.right());
+        double bottom = std::max(a.bottom(), b.bottom());
+        return RectF(left, top, right - left, bottom - top);
+    }
+
+    static double area(const RectF& r)
+    {
+        return r.width() * r.height();
+    }
+
+    static double enlargement(const RectF& r, const RectF& add)
+    {
+        return area(bound(r, add)) - area(r);
+    }
+
+    static const RectF& rectOf(const Entry& e) { return e.rect; }
+    static const RectF& rectOf(const std::unique_ptr<Node>& n) { return n->rect; }
+
+    template<typename T>
+    static RectF boundAll(const std::vector<T>& items)
+    {
+        RectF r = rectOf(items.front());
+        for (size_t i = 1; i < items.size(); ++i) {
+            r = bound(r, rectOf(items[i]));
+        }
+        return r;
+    }
+
+    static void recalcRect(Node* node)
+    {
+        if (node->isEmpty()) {
+            return;
+        }
+
+        node->rect = node->isLeaf ? boundAll(node->entries) : boundAll(node->children);
+    }
+
+    static void updateRects(Node* node)
+    {
+        for (; node; node = node->parent) {
+            recalcRect(node);
+        }
+    }
+
+    Node* chooseLeaf(const RectF& rect) const
+    {
+        Node* node = m_root.get();
+        while (!node->isLeaf) {
+            Node* best = nullptr;
+            double bestEnlargement = std::numeric_limits<double>::max();
+            double bestArea = std::numeric_limits<double>::max();
+
+            for (const std::unique_ptr<Node>& child : node->children) {
+                double e = enlargement(child->rect, rect);
+                double a = area(child->rect);
+                if (e < bestEnlargement || (e == bestEnlargement && a < bestArea)) {
+                    best = child.get();
+                    bestEnlargement = e;
+                    bestArea = a;
+                }
+            }
+
+            node = best;
+        }
+
+        return node;
+    }
+
+    //! NOTE Quadratic split: the pair wasting the most area seeds the two groups,
+    //! the rest go to the group that grows least
+    template<typename T>
+    static void splitItems(std::vector<T>& items, std::vector<T>& moved)
+    {
+        size_t seed1 = 0;
+        size_t seed2 = 1;
+        double worst = -std::numeric_limits<double>::max();
+        for (size_t i = 0; i < items.size(); ++i) {
+            for (size_t j = i + 1; j < items.size(); ++j) {
+                double d = area(bound(rectOf(items[i]), rectOf(items[j]))) - area(rectOf(items[i])) - area(rectOf(items[j]));
+                if (d > worst) {
+                    worst = d;
+                    seed1 = i;
+                    seed2 = j;
+                }
+            }
+        }
+
+        std::vector<T> all = std::move(items);
+        items.clear();
+
+        RectF rect1 = rectOf(all[seed1]);
+        RectF rect2 = rectOf(all[seed2]);
+        items.push_back(std::move(all[seed1]));
+        moved.push_back(std::move(all[seed2]));
+
+        size_t remaining = all.size() - 2;
+        for (size_t i = 0; i < all.size(); ++i) {
+            if (i == seed1 || i == seed2) {
+                continue;
+            }
+
+            bool toFirst = false;
+            if (items.size() + remaining <= MIN_ENTRIES) {
+                toFirst = true;
+            } else if (moved.size() + remaining <= MIN_ENTRIES) {
+                toFirst = false;
+            } else {
+                const RectF& r = rectOf(all[i]);
+                double e1 = enlargement(rect1, r);
+                double e2 = enlargement(rect2, r);
+                if (e1 != e2) {
+                    toFirst = e1 < e2;
+                } else if (area(rect1) != area(rect2)) {
+                    toFirst = area(rect1) < area(rect2);
+                } else {
+                    toFirst = items.size() <= moved.size();
+                }
+            }
+
+            if (toFirst) {
+                rect1 = bound(rect1, rectOf(all[i]));
+                items.push_back(std::move(all[i]));
+            } else {
+                rect2 = bound(rect2, rectOf(all[i]));
+                moved.push_back(std::move(all[i]));
+            }
+
+            --remaining;
+        }
+    }
+
+    void split(Node* node)
+    {
+        while (node && node->count() > MAX_ENTRIES) {
+            auto sibling = std::make_unique<Node>();
+            sibling->isLeaf = node->isLeaf;
+
+            if (node->isLeaf) {
+                splitItems(node->entries, sibling->entries);
+                for (const Entry& e : sibling->entries) {
+                    m_leaves[e.value] = sibling.get();
+                }
+            } else {
+                splitItems(node->children, sibling->children);
+                for (const std::unique_ptr<Node>& child : sibling->children) {
+                    child->parent = sibling.get();
+                }
+            }
+
+            recalcRect(node);
+            recalcRect(sibling.get());
+
+            if (!node->parent) {
+                //! NOTE The root is split, the tree grows by one level
+                auto root = std::make_unique<Node>();
+                root->isLeaf = false;
+                node->parent = root.get();
+                sibling->parent = root.get();
+                root->children.push_back(std::move(m_root));
+                root->children.push_back(std::move(sibling));
+                recalcRect(root.get());
+                m_root = std::move(root);
+                return;
+            }
+
+            Node* parent = node->parent;
+            sibling->parent = parent;
+            parent->children.push_back(std::move(sibling));
+            recalcRect(parent);
+            node = parent;
+        }
+
+        updateRects(node);
+    }
+
+    std::unique_ptr<Node> m_root;
+    std::unordered_map<Value, Node*> m_leaves;
+};
+}
+
+#endif // MU_ENGRAVING_RTREE_H
@@ -690,18 +690,62 @@ void EngravingFont::draw(SymId id, Painter* painter, double mag, const PointF& p
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos) const
 {
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos);
-        pos.setX(pos.x() + advance(id, mag));
-    }
+    draw(ids, painter, SizeF(mag, mag), startPos);
 }
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos) const
 {
+    std::vector<PointF> positions;
+    positions.reserve(ids.size());
+
     PointF pos(startPos);
     for (SymId id : ids) {
-        draw(id, painter, mag, pos);
+        positions.push_back(pos);
         pos.setX(pos.x() + advance(id, mag.width()));
     }
+
+    draw(ids, positions, painter, mag);
+}
+
+void EngravingFont::draw(const SymIdList& ids, const std::vector<PointF>& positions, Painter* painter, const SizeF& mag) const
+{
+    IF_ASSERT_FAILED(ids.size() == positions.size()) {
+        return;
+    }
+
+    //! NOTE Consecutive simple symbols are drawn as one glyph run,
+    //! compound and missing symbols break the run and are drawn as before
+    std::vector<PointF> points;
+    std::vector<char32_t> codes;
+
+    auto drawRun = [this, painter, &mag, &points, &codes]() {
+        if (codes.empty()) {
+            return;
+        }
+
+        painter->save();
+        double size = 20.0 * MScore::pixelRatio;
+        m_font.setPointSizeF(size);
+        painter->scale(mag.width(), mag.height());
+        painter->setFont(m_font);
+        painter->drawSymbols(points.data(), codes.data(), codes.size());
+        painter->restore();
+
+        points.clear();
+        codes.clear();
+    };
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const Sym& sym = this->sym(ids[i]);
+        if (sym.isCompound() || !sym.isValid()) {
+            drawRun();
+            draw(ids[i], painter, mag, positions[i]);
+            continue;
+        }
+
+        points.emplace_back(positions[i].x() / mag.width(), positions[i].y() / mag.height());
+        codes.push_back(symCode(ids[i]));
+    }
+
+    drawRun();
 }
@@ -89,6 +89,7 @@ public:
 
     void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const override;
     void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const override;
+    void draw(const SymIdList& ids, const std::vector<PointF>& positions, draw::Painter* p, const SizeF& mag) const override;
 
     void ensureLoad();
 
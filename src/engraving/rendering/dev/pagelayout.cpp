@@ -407,8 +407,6 @@ void PageLayout::collectPage(LayoutContext& ctx)
             }
         }
     }
-
-    ctx.mutState().page()->invalidateBspTree();
 }
 
 //---------------------------------------------------------
@@ -22,9 +22,14 @@
 #include "paint.h"
 
 #include "draw/painter.h"
+#include "draw/displaylistrecorder.h"
+#include "draw/utils/displaylistpaint.h"
 #include "dom/score.h"
 #include "dom/page.h"
 #include "dom/engravingitem.h"
+#include "dom/mscore.h"
+
+#include "rendering/displaylistcache.h"
 
 #include "tdraw.h"
 #include "debugpaint.h"
@@ -32,8 +37,37 @@
 #include "log.h"
 
 using namespace mu::engraving;
+using namespace mu::engraving::rendering;
 using namespace mu::engraving::rendering::dev;
 
+static DisplayListCache::Context displayListContext(const Score* score)
+{
+    DisplayListCache::Context ctx;
+    ctx.printing = score->printing();
+    ctx.showInvisible = score->isShowInvisible();
+    ctx.showUnprintable = score->showUnprintable();
+    ctx.showFrames = score->showFrames();
+    ctx.pixelRatio = MScore::pixelRatio;
+
+    if (const auto& configuration = EngravingItem::engravingConfiguration()) {
+        ctx.scoreInversion = configuration->scoreInversionEnabled();
+        ctx.defaultColor = configuration->defaultColor();
+        ctx.fontPrimaryColor = configuration->fontPrimaryColor();
+        ctx.formattingMarksColor = configuration->formattingMarksColor();
+    }
+
+    return ctx;
+}
+
+static uint64_t displayListKey(const EngravingItem* item, bool zoomedOut)
+{
+    const draw::Color color = item->curColor();
+    const uint64_t rgba = (uint64_t(color.red()) << 24) | (uint64_t(color.green()) << 16) | (uint64_t(color.blue()) << 8)
+                          | uint64_t(color.alpha());
+
+    return (uint64_t(zoomedOut) << 33) | (uint64_t(color.isValid()) << 32) | rgba;
+}
+
 void Paint::paintScore(draw::Painter* painter, Score* score, const IScoreRenderer::PaintOptions& opt)
 {
     TRACEFUNC;
@@ -138,7 +172,7 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const IScoreRendere
             }
 
             std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements);
+            paintItems(*painter, elements, opt.displayListCache);
             //DebugPaint::paintPageTree(*painter, page);
 
             if (disableClipping) {
@@ -222,18 +256,88 @@ void Paint::paintItem(mu::draw::Painter& painter, const EngravingItem* item)
     painter.translate(-itemPosition);
 }
 
-void Paint::paintItems(mu::draw::Painter& painter, const std::vector<EngravingItem*>& items)
+bool Paint::canUseDisplayList(const EngravingItem* item)
+{
+    //! NOTE Images are drawn as pixmaps scaled to the view, the lasso depends on the zoom,
+    //! the selected items may be in edit mode and are few anyway
+    if (item->isImage() || item->isLasso() || item->selected()) {
+        return false;
+    }
+
+    //! NOTE The extended provider (tests, diagnostics) should see every draw call
+    return draw::Painter::extended == nullptr;
+}
+
+void Paint::paintItemDisplayList(mu::draw::Painter& painter, const EngravingItem* item, DisplayListCache& cache)
+{
+    TRACEFUNC;
+    const EngravingItem::LayoutData* ldata = item->ldata();
+    if (ldata->isSkipDraw()) {
+        return;
+    }
+    item->itemDiscovered = false;
+    PointF itemPosition(item->pagePos());
+
+    painter.translate(itemPosition);
+
+    //! NOTE Some texts are drawn differently when zoomed out (see TextBase::drawTextWorkaround),
+    //! so the zoom band is a part of the key and the list is recorded with a scale below 1 in that case,
+    //! 0.5 keeps the inverted transform exact
+    const bool zoomedOut = painter.worldTransform().m11() < 1.0;
+    const uint64_t key = displayListKey(item, zoomedOut);
+    draw::DisplayListPtr list = ldata->displayList();
+
+    if (!list || list->key != key || !cache.touch(list.get())) {
+        draw::DrawData::State initialState;
+        initialState.pen = painter.pen();
+        initialState.brush = painter.brush();
+        initialState.font = painter.font();
+        if (zoomedOut) {
+            initialState.transform.scale(0.5, 0.5);
+        }
+
+        auto recorder = std::make_shared<draw::DisplayListRecorder>(initialState);
+        {
+            draw::Painter recordPainter(recorder, "displaylist");
+            TDraw::drawItem(item, &recordPainter);
+        }
+
+        std::shared_ptr<draw::DisplayList> recorded = recorder->displayList();
+        recorded->key = key;
+        ldata->setDisplayList(recorded);
+        cache.add(recorded);
+        list = recorded;
+    }
+
+    if (list->isReplayable) {
+        draw::DisplayListPaint::paint(&painter, *list);
+    } else {
+        TDraw::drawItem(item, &painter);
+    }
+
+    painter.translate(-itemPosition);
+}
+
+void Paint::paintItems(mu::draw::Painter& painter, const std::vector<EngravingItem*>& items, DisplayListCache* displayListCache)
 {
     TRACEFUNC;
     std::vector<EngravingItem*> sortedItems(items.begin(), items.end());
 
     std::sort(sortedItems.begin(), sortedItems.end(), mu::engraving::elementLessThan);
 
+    if (displayListCache && !sortedItems.empty()) {
+        displayListCache->setContext(displayListContext(sortedItems.front()->score()));
+    }
+
     for (const EngravingItem* item : sortedItems) {
         if (!item->isInteractionAvailable()) {
             continue;
         }
 
-        paintItem(painter, item);
+        if (displayListCache && canUseDisplayList(item)) {
+            paintItemDisplayList(painter, item, *displayListCache);
+        } else {
+            paintItem(painter, item);
+        }
     }
 }
@@ -40,12 +40,16 @@ public:
 
     static void paintScore(draw::Painter* painter, Score* score, const IScoreRenderer::PaintOptions& opt);
     static void paintItem(draw::Painter& painter, const EngravingItem* item);
-    static void paintItems(draw::Painter& painter, const std::vector<EngravingItem*>& items);
+    //! NOTE With a display list cache the draw calls of every item are recorded once
+    //! and replayed until the layout data of the item changes or the cache releases the list
+    static void paintItems(draw::Painter& painter, const std::vector<EngravingItem*>& items, DisplayListCache* displayListCache = nullptr);
 
     static SizeF pageSizeInch(const Score* score);
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::PaintOptions& opt);
 
 private:
+    static bool canUseDisplayList(const EngravingItem* item);
+    static void paintItemDisplayList(draw::Painter& painter, const EngravingItem* item, DisplayListCache& cache);
 };
 }
 
@@ -180,16 +180,20 @@ void ScorePageViewLayout::layoutPageView(Score* score, LayoutContext& ctx, const
     }
 #endif
 
-    doLayout(ctx);
+    bool isPageLimitReached = doLayout(ctx);
 
-    layoutFinished(score, ctx);
+    layoutFinished(score, ctx, isPageLimitReached);
 }
 
-void ScorePageViewLayout::doLayout(LayoutContext& ctx)
+bool ScorePageViewLayout::doLayout(LayoutContext& ctx)
 {
     MeasureLayout::getNextMeasure(ctx);
     ctx.mutState().setCurSystem(SystemLayout::collectSystem(ctx));
 
+    //! NOTE The limit is for the new pages, the last existing one may be laid out again
+    const size_t pageLimit = ctx.conf().pageLimit();
+    const page_idx_t endPageIdx = ctx.dom().npages() + pageLimit;
+
     const MeasureBase* lmb = nullptr;
     do {
         PageLayout::getNextPage(ctx);
@@ -210,11 +214,16 @@ void ScorePageViewLayout::doLayout(LayoutContext& ctx)
         //    c) this page ends with the same measure as the previous layout
         //    pageOldMeasure will be last measure from previous layout if range was completed on or before this page
         //    it will be nullptr if this page was never laid out or if we collected a system for next page
-    } while (ctx.state().curSystem() && !(ctx.state().rangeDone() && lmb == ctx.state().pageOldMeasure()));
+        // or
+        // 3) we have laid out as many pages as allowed, the rest will be laid out by the next layout
+    } while (ctx.state().curSystem() && !(ctx.state().rangeDone() && lmb == ctx.state().pageOldMeasure())
+             && !(pageLimit > 0 && ctx.state().pageIdx() >= endPageIdx));
     // && page->system(0)->measures().back()->tick() > endTick // FIXME: perhaps the first measure was meant? Or last system?
+
+    return ctx.state().curSystem() && pageLimit > 0 && ctx.state().pageIdx() >= endPageIdx;
 }
 
-void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx)
+void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx, bool isPageLimitReached)
 {
     LayoutState& state = ctx.mutState();
 
@@ -229,11 +238,10 @@ void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx)
             score->pages().pop_back();
             delete p;
         }
-    } else {
-        Page* p = state.curSystem()->page();
-        if (p && (p != state.page())) {
-            p->invalidateBspTree();
-        }
+    } else if (isPageLimitReached) {
+        //! NOTE The collected system is not on a page yet,
+        //! the next layout starts from it
+        score->setLayoutPendingTick(state.curSystem()->measures().front()->tick());
     }
 
     score->systems().insert(score->systems().end(), state.systemList().begin(), state.systemList().end());
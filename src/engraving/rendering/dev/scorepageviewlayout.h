@@ -36,9 +36,9 @@ private:
     static void initLayoutContext(const Score* score, LayoutContext& ctx, const Fraction& stick, const Fraction& etick);
     static void prepareScore(Score* score, const LayoutContext& ctx);
 
-    static void doLayout(LayoutContext& ctx);
+    static bool doLayout(LayoutContext& ctx);
 
-    static void layoutFinished(Score* score, LayoutContext& ctx);
+    static void layoutFinished(Score* score, LayoutContext& ctx, bool isPageLimitReached);
 };
 }
 
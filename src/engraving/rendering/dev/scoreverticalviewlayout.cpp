@@ -190,11 +190,6 @@ void ScoreVerticalViewLayout::doLayout(LayoutContext& ctx)
             ctx.mutDom().pages().pop_back();
             delete p;
         }
-    } else {
-        Page* p = ctx.mutState().curSystem()->page();
-        if (p && (p != ctx.state().page())) {
-            p->invalidateBspTree();
-        }
     }
     ctx.mutDom().systems().insert(ctx.mutDom().systems().end(), ctx.state().systemList().begin(), ctx.state().systemList().end());
 }
@@ -401,9 +401,14 @@ void TDraw::draw(const Accidental* item, draw::Painter* painter)
     }
 
     painter->setPen(item->curColor());
+
+    SymIdList syms;
+    std::vector<PointF> positions;
     for (const Accidental::LayoutData::Sym& e : item->ldata()->syms) {
-        item->drawSymbol(e.sym, painter, PointF(e.x, e.y));
+        syms.push_back(e.sym);
+        positions.emplace_back(e.x, e.y);
     }
+    item->drawSymbols(syms, positions, painter);
 }
 
 void TDraw::draw(const ActionIcon* item, draw::Painter* painter)
@@ -634,8 +639,7 @@ static void drawDots(const BarLine* item, Painter* painter, double x)
         y2l += stYOffset;
     }
 
-    item->drawSymbol(SymId::repeatDot, painter, PointF(x, y1l));
-    item->drawSymbol(SymId::repeatDot, painter, PointF(x, y2l));
+    item->drawSymbols({ SymId::repeatDot, SymId::repeatDot }, { PointF(x, y1l), PointF(x, y2l) }, painter);
 }
 
 static void drawTips(const BarLine* item, const BarLine::LayoutData* data, Painter* painter, bool reversed, double x)
@@ -1971,21 +1975,29 @@ void TDraw::draw(const KeySig* item, Painter* painter)
     int lines = item->staff() ? item->staff()->staffTypeForElement(item)->lines() : 5;
     double ledgerLineWidth = item->style().styleMM(Sid::ledgerLineWidth) * item->mag();
     double ledgerExtraLen = item->style().styleS(Sid::ledgerLineLength).val() * _spatium;
+
+    //! NOTE All the symbols are drawn at once, then the ledger lines
+    SymIdList syms;
+    std::vector<PointF> positions;
+    for (const KeySym& ks : ldata->keySymbols) {
+        syms.push_back(ks.sym);
+        positions.emplace_back(ks.xPos * _spatium, ks.line * step);
+    }
+    item->drawSymbols(syms, positions, painter);
+
+    painter->setPen(Pen(item->curColor(), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
     for (const KeySym& ks : ldata->keySymbols) {
         double x = ks.xPos * _spatium;
-        double y = ks.line * step;
-        item->drawSymbol(ks.sym, painter, PointF(x, y));
         // ledger lines
         double _symWidth = item->symWidth(ks.sym);
         double x1 = x - ledgerExtraLen;
         double x2 = x + _symWidth + ledgerExtraLen;
-        painter->setPen(Pen(item->curColor(), ledgerLineWidth, PenStyle::SolidLine, PenCapStyle::FlatCap));
         for (int i = -2; i >= ks.line; i -= 2) { // above
-            y = i * step;
+            double y = i * step;
             painter->drawLine(LineF(x1, y, x2, y));
         }
         for (int i = lines * 2; i <= ks.line; i += 2) { // below
-            y = i * step;
+            double y = i * step;
             painter->drawLine(LineF(x1, y, x2, y));
         }
     }
@@ -2155,11 +2167,13 @@ void TDraw::draw(const MMRest* item, Painter* painter)
         // draw rest symbols
         double x = (ldata->restWidth - ldata->symsWidth) * 0.5;
         double spacing = item->style().styleMM(Sid::mmRestOldStyleSpacing);
+        std::vector<PointF> positions;
         for (SymId sym : ldata->restSyms) {
             double y = (sym == SymId::restWhole ? -_spatium : 0);
-            item->drawSymbol(sym, painter, PointF(x, y));
+            positions.emplace_back(x, y);
             x += item->symBbox(sym).width() + spacing;
         }
+        item->drawSymbols(ldata->restSyms, positions, painter);
     } else {
         double mag = item->staff()->staffMag(item->tick());
         mu::draw::Pen pen(painter->pen());
@@ -2745,9 +2759,12 @@ void TDraw::draw(const Stem* item, Painter* painter)
         double x     = item->chord()->dotPosX();
         double y     = ((STAFFTYPE_TAB_DEFAULTSTEMLEN_DN * 0.2) * sp) * (isUp ? -1.0 : 1.0);
         double step  = item->style().styleS(Sid::dotDotDistance).val() * sp;
+        SymIdList syms(nDots, SymId::augmentationDot);
+        std::vector<PointF> positions;
         for (int dot = 0; dot < nDots; dot++, x += step) {
-            item->drawSymbol(SymId::augmentationDot, painter, PointF(x, y));
+            positions.emplace_back(x, y);
         }
+        item->drawSymbols(syms, positions, painter);
     }
 }
 
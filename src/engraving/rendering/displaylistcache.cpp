@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "displaylistcache.h"
+
+#include "realfn.h"
+
+using namespace mu::engraving::rendering;
+
+bool DisplayListCache::Context::operator==(const Context& o) const
+{
+    return printing == o.printing && showInvisible == o.showInvisible && showUnprintable == o.showUnprintable
+           && showFrames == o.showFrames && scoreInversion == o.scoreInversion && RealIsEqual(pixelRatio, o.pixelRatio)
+           && defaultColor == o.defaultColor && fontPrimaryColor == o.fontPrimaryColor
+           && formattingMarksColor == o.formattingMarksColor;
+}
+
+DisplayListCache::DisplayListCache(size_t maxBytes)
+    : m_maxBytes(maxBytes)
+{
+}
+
+void DisplayListCache::setContext(const Context& ctx)
+{
+    if (m_hasContext && ctx == m_context) {
+        return;
+    }
+
+    clear();
+    m_context = ctx;
+    m_hasContext = true;
+}
+
+void DisplayListCache::add(const draw::DisplayListPtr& list)
+{
+    if (!list || m_positions.find(list.get()) != m_positions.end()) {
+        return;
+    }
+
+    const size_t bytes = list->memoryUsage();
+    m_lists.push_front(Entry { list, bytes });
+    m_positions.emplace(list.get(), m_lists.begin());
+    m_bytes += bytes;
+
+    evict();
+}
+
+bool DisplayListCache::touch(const draw::DisplayList* list)
+{
+    auto it = m_positions.find(list);
+    if (it == m_positions.end()) {
+        return false;
+    }
+
+    m_lists.splice(m_lists.begin(), m_lists, it->second);
+    return true;
+}
+
+void DisplayListCache::clear()
+{
+    m_positions.clear();
+    m_lists.clear();
+    m_bytes = 0;
+}
+
+void DisplayListCache::evict()
+{
+    //! NOTE The most recent list is kept even if it alone exceeds the limit, it is being painted
+    while (m_bytes > m_maxBytes && m_lists.size() > 1) {
+        const Entry& entry = m_lists.back();
+        m_bytes -= entry.bytes;
+        m_positions.erase(entry.list.get());
+        m_lists.pop_back();
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_DISPLAYLISTCACHE_H
+#define MU_ENGRAVING_DISPLAYLISTCACHE_H
+
+#include <list>
+#include <unordered_map>
+
+#include "draw/types/color.h"
+#include "draw/types/displaylist.h"
+
+namespace mu::engraving::rendering {
+//! NOTE Owns the display lists recorded for one paint target of one score, see Paint::paintItems.
+//! The items only keep weak references to their lists, so the cache bounds the memory:
+//! the least recently painted lists are released first, and all of them when the paint context changes.
+class DisplayListCache
+{
+public:
+    static constexpr size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    //! NOTE Everything, besides the layout data, the color of the item and the zoom band, that changes how the items are drawn
+    struct Context {
+        bool printing = false;
+        bool showInvisible = false;
+        bool showUnprintable = false;
+        bool showFrames = false;
+        bool scoreInversion = false;
+        double pixelRatio = 0.0;
+        draw::Color defaultColor;
+        draw::Color fontPrimaryColor;
+        draw::Color formattingMarksColor;
+
+        bool operator==(const Context& o) const;
+        bool operator!=(const Context& o) const { return !this->operator==(o); }
+    };
+
+    explicit DisplayListCache(size_t maxBytes = DEFAULT_MAX_BYTES);
+
+    //! NOTE Releases all the lists if the context differs from the previous one
+    void setContext(const Context& ctx);
+
+    void add(const draw::DisplayListPtr& list);
+
+    //! NOTE Marks the list as recently used, returns false if the list is not owned by this cache
+    bool touch(const draw::DisplayList* list);
+
+    void clear();
+
+    size_t size() const { return m_lists.size(); }
+    size_t bytes() const { return m_bytes; }
+
+private:
+    struct Entry {
+        draw::DisplayListPtr list;
+        size_t bytes = 0;
+    };
+
+    void evict();
+
+    Context m_context;
+    bool m_hasContext = false;
+
+    std::list<Entry> m_lists; // most recently used first
+    std::unordered_map<const draw::DisplayList*, std::list<Entry>::iterator> m_positions;
+    size_t m_bytes = 0;
+    size_t m_maxBytes = 0;
+};
+}
+
+#endif // MU_ENGRAVING_DISPLAYLISTCACHE_H
@@ -87,6 +87,8 @@ class TimeSig;
 }
 
 namespace mu::engraving::rendering {
+class DisplayListCache;
+
 class IScoreRenderer : MODULE_EXPORT_INTERFACE
 {
     INTERFACE_ID(IScoreRenderer)
@@ -110,6 +112,7 @@ public:
         int copyCount = 1;
         int trimMarginPixelSize = -1;
         int deviceDpi = -1;
+        DisplayListCache* displayListCache = nullptr; // replay the recorded draw calls of the items, see Paint::paintItems
 
         std::function<void(draw::Painter* painter, const Page* page, const RectF& pageRect)> onPaintPageSheet;
         std::function<void()> onNewPage;
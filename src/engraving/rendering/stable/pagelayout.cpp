@@ -379,8 +379,6 @@ void PageLayout::collectPage(LayoutContext& ctx)
             }
         }
     }
-
-    ctx.mutState().page()->invalidateBspTree();
 }
 
 //---------------------------------------------------------
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/rendering/displaylistcache.h"
+
+using namespace mu;
+using namespace mu::engraving::rendering;
+
+class Engraving_DisplayListCacheTests : public ::testing::Test
+{
+};
+
+static std::shared_ptr<draw::DisplayList> makeList(size_t opCount)
+{
+    auto list = std::make_shared<draw::DisplayList>();
+    list->ops.resize(opCount);
+    return list;
+}
+
+TEST_F(Engraving_DisplayListCacheTests, ReleasesLeastRecentlyUsedLists)
+{
+    const size_t listBytes = makeList(100)->memoryUsage();
+    DisplayListCache cache(listBytes * 2);
+    cache.setContext(DisplayListCache::Context());
+
+    std::shared_ptr<draw::DisplayList> first = makeList(100);
+    std::shared_ptr<draw::DisplayList> second = makeList(100);
+    std::weak_ptr<const draw::DisplayList> firstRef = first;
+    std::weak_ptr<const draw::DisplayList> secondRef = second;
+
+    cache.add(first);
+    cache.add(second);
+    first.reset();
+    second.reset();
+    EXPECT_EQ(cache.size(), 2u);
+
+    // the first list was painted again, so the second one is released
+    EXPECT_TRUE(cache.touch(firstRef.lock().get()));
+    cache.add(makeList(100));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_LE(cache.bytes(), listBytes * 2);
+    EXPECT_FALSE(firstRef.expired());
+    EXPECT_TRUE(secondRef.expired());
+}
+
+TEST_F(Engraving_DisplayListCacheTests, ContextChangeReleasesAllLists)
+{
+    DisplayListCache cache;
+
+    DisplayListCache::Context ctx;
+    cache.setContext(ctx);
+
+    std::shared_ptr<draw::DisplayList> list = makeList(10);
+    std::weak_ptr<const draw::DisplayList> ref = list;
+    cache.add(list);
+    list.reset();
+
+    // the same context keeps the lists
+    cache.setContext(ctx);
+    EXPECT_FALSE(ref.expired());
+
+    ctx.scoreInversion = true;
+    cache.setContext(ctx);
+    EXPECT_TRUE(ref.expired());
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.bytes(), 0u);
+}
+
+TEST_F(Engraving_DisplayListCacheTests, ForeignListsAreNotTouched)
+{
+    DisplayListCache cache;
+    cache.setContext(DisplayListCache::Context());
+
+    std::shared_ptr<draw::DisplayList> list = makeList(10);
+    EXPECT_FALSE(cache.touch(list.get()));
+
+    cache.add(list);
+    EXPECT_TRUE(cache.touch(list.get()));
+}
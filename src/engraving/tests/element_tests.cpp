@@ -103,3 +103,51 @@ TEST_F(Engraving_ElementTests, DISABLED_testIds)
         delete ee;
     }
 }
+
+TEST_F(Engraving_ElementTests, eidRegister)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScore();
+
+    EngravingItem* e = Factory::createItem(ElementType::STAFF_TEXT, score->dummy());
+    ASSERT_TRUE(e->eid().isValid());
+    EXPECT_EQ(score->itemByEID(e->eid()), e);
+
+    // a clone gets its own EID
+    EngravingItem* clone = e->clone();
+    ASSERT_TRUE(clone->eid().isValid());
+    EXPECT_NE(clone->eid(), e->eid());
+    EXPECT_EQ(score->itemByEID(clone->eid()), clone);
+
+    // setting the EID (e.g. on read) updates the register
+    EID oldEID = clone->eid();
+    EID newEID(ElementType::STAFF_TEXT, score->getEID()->lastID() + 100);
+    clone->setEID(newEID);
+    EXPECT_EQ(score->itemByEID(oldEID), nullptr);
+    EXPECT_EQ(score->itemByEID(newEID), clone);
+
+    // destroyed objects are removed from the register
+    EID eid = e->eid();
+    delete e;
+    EXPECT_EQ(score->itemByEID(eid), nullptr);
+    delete clone;
+    EXPECT_EQ(score->itemByEID(newEID), nullptr);
+
+    EXPECT_EQ(score->itemByEID(EID()), nullptr);
+
+    delete score;
+}
+
+TEST_F(Engraving_ElementTests, eidRegisterElementOutlivesScore)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScore();
+
+    // e.g. an element held by a clipboard, not owned by the score
+    EngravingItem* e = Factory::createItem(ElementType::STAFF_TEXT, score->dummy());
+    ASSERT_TRUE(e->eid().isValid());
+    e->setParent(nullptr);
+
+    delete score;
+
+    // must not access the register of the deleted score
+    delete e;
+}
@@ -152,3 +152,46 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+TEST_F(Engraving_LayoutElementsTests, tstProgressiveLayout)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    EXPECT_TRUE(score);
+
+    // the complete layout, done by readScore
+    const size_t pageCount = score->npages();
+    ASSERT_GT(pageCount, 2);
+
+    std::vector<std::pair<Fraction, size_t> > systems;
+    for (const System* system : score->systems()) {
+        systems.push_back({ system->measures().front()->tick(), system->page()->no() });
+    }
+
+    // only the first page
+    score->setLayoutPageLimit(1);
+    score->doLayout();
+    score->setLayoutPageLimit(0);
+
+    EXPECT_TRUE(score->isLayoutPending());
+    EXPECT_EQ(score->npages(), 1);
+
+    // one more page at a time
+    size_t steps = 0;
+    while (score->isLayoutPending() && steps < pageCount) {
+        score->continueLayout(1);
+        ++steps;
+        EXPECT_EQ(score->npages(), std::min(steps + 1, pageCount));
+    }
+
+    EXPECT_FALSE(score->isLayoutPending());
+    ASSERT_EQ(score->npages(), pageCount);
+    ASSERT_EQ(score->systems().size(), systems.size());
+
+    for (size_t i = 0; i < systems.size(); ++i) {
+        const System* system = score->systems().at(i);
+        EXPECT_EQ(system->measures().front()->tick(), systems.at(i).first);
+        EXPECT_EQ(system->page()->no(), systems.at(i).second);
+    }
+
+    delete score;
+}
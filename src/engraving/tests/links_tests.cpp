@@ -464,3 +464,71 @@ TEST_F(Engraving_LinksTests, test5LinkedParts_94911)
     EXPECT_TRUE(e->links()->size() == 3);
     EXPECT_TRUE(score->excerpts().size() == 1);
 }
+
+//---------------------------------------------------------
+//   batchedLinkedPropertyChange
+///  Change a linked property of a chord on a staff with
+///  two linked copies inside a property batch: all copies
+///  change, and only one undo command is recorded
+//---------------------------------------------------------
+
+TEST_F(Engraving_LinksTests, batchedLinkedPropertyChange)
+{
+    MCursor c;
+    c.setTimeSig(Fraction(4, 4));
+    c.createScore(u"test");
+    c.addPart(u"voice");
+    c.move(0, Fraction(0, 1));       // move to track 0 tick 0
+
+    c.addKeySig(Key(1));
+    c.addTimeSig(Fraction(4, 4));
+    c.addChord(60, TDuration(DurationType::V_QUARTER));
+
+    MasterScore* score = c.score();
+    score->doLayout();
+
+    // add two linked staves
+    score->startCmd();
+    Staff* oStaff = score->staff(0);
+    for (staff_idx_t idx : { 1, 2 }) {
+        Staff* staff = Factory::createStaff(oStaff->part());
+        staff->setPart(oStaff->part());
+        score->undoInsertStaff(staff, idx, false);
+        Excerpt::cloneStaff(oStaff, staff);
+    }
+    score->endCmd();
+
+    Segment* s = score->firstMeasure()->first(SegmentType::ChordRest);
+    EngravingItem* e = s->element(0);
+    ASSERT_TRUE(e && e->isChord());
+    ASSERT_TRUE(e->links() && e->links()->size() == 3);
+
+    // change the property within a batch
+    score->startCmd();
+    score->startPropertyBatch();
+    e->undoChangeProperty(Pid::BEAM_MODE, BeamMode::NONE);
+    score->endPropertyBatch();
+    UndoMacro* macro = score->undoStack()->current();
+    ASSERT_TRUE(macro);
+    ASSERT_EQ(macro->childCount(), 1u);
+    EXPECT_EQ(macro->commands().front()->type(), CommandType::ChangeProperties);
+    EXPECT_EQ(static_cast<ChangeProperties*>(macro->commands().front())->size(), 3u);
+    EXPECT_TRUE(macro->changesInfo().changedPropertyIdSet.count(Pid::BEAM_MODE) > 0);
+    score->endCmd();
+
+    for (EngravingObject* linked : *e->links()) {
+        EXPECT_EQ(linked->getProperty(Pid::BEAM_MODE).value<BeamMode>(), BeamMode::NONE);
+    }
+
+    // undo restores all copies
+    score->undoRedo(true, 0);
+    for (EngravingObject* linked : *e->links()) {
+        EXPECT_EQ(linked->getProperty(Pid::BEAM_MODE).value<BeamMode>(), BeamMode::AUTO);
+    }
+
+    // redo changes them again
+    score->undoRedo(false, 0);
+    for (EngravingObject* linked : *e->links()) {
+        EXPECT_EQ(linked->getProperty(Pid::BEAM_MODE).value<BeamMode>(), BeamMode::NONE);
+    }
+}
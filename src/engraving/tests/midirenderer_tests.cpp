@@ -22,12 +22,17 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <map>
+
 #include "utils/scorerw.h"
 #include "engraving/compat/midi/compatmidirender.h"
 #include "engraving/infrastructure/localfileinfoprovider.h"
 #include "engraving/rw/mscloader.h"
 #include "engraving/dom/noteevent.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 class MidiRenderer_Tests : public ::testing::Test
@@ -177,6 +182,35 @@ TEST_F(MidiRenderer_Tests, subscriptOperator)
     EXPECT_EQ(events2.size(), 193);
 }
 
+TEST_F(MidiRenderer_Tests, eventsChannelOrder)
+{
+    EventsHolder events;
+    events[DEFAULT_CHANNEL].insert(std::make_pair(100, noteEvent(60, 80, DEFAULT_CHANNEL)));
+    events[DEFAULT_CHANNEL].insert(std::make_pair(0, noteEvent(61, 80, DEFAULT_CHANNEL)));
+    events[DEFAULT_CHANNEL].insert(std::make_pair(100, noteEvent(62, 80, DEFAULT_CHANNEL)));
+
+    EventsHolder other;
+    other[DEFAULT_CHANNEL].insert(std::make_pair(100, noteEvent(63, 80, DEFAULT_CHANNEL)));
+    other[DEFAULT_CHANNEL].insert(std::make_pair(50, noteEvent(64, 80, DEFAULT_CHANNEL)));
+    events[DEFAULT_CHANNEL].merge(other[DEFAULT_CHANNEL]);
+
+    //! events at the same tick keep their insertion order, merged ones come last
+    std::vector<std::pair<int, int> > expected = { { 0, 61 }, { 50, 64 }, { 100, 60 }, { 100, 62 }, { 100, 63 } };
+    ASSERT_EQ(events[DEFAULT_CHANNEL].size(), expected.size());
+    EXPECT_TRUE(other[DEFAULT_CHANNEL].empty());
+
+    size_t idx = 0;
+    for (const auto& ev : events[DEFAULT_CHANNEL]) {
+        EXPECT_EQ(ev.first, expected[idx].first);
+        EXPECT_EQ(ev.second.pitch(), expected[idx].second);
+        ++idx;
+    }
+
+    EXPECT_EQ(events[DEFAULT_CHANNEL].count(100), 3);
+    EXPECT_EQ(events[DEFAULT_CHANNEL].find(100)->second.pitch(), 60);
+    EXPECT_EQ(events[DEFAULT_CHANNEL].find(25), events[DEFAULT_CHANNEL].end());
+}
+
 TEST_F(MidiRenderer_Tests, oneGuitarNote)
 {
     constexpr int defVol = 96; // f
@@ -920,3 +954,53 @@ TEST_F(MidiRenderer_Tests, hairpinDynamicInside)
     DISABLED TESTS BELOW
 
 *****************************************************************************/
+
+//---------------------------------------------------------
+//   renderBenchmark
+//    renders the largest test score, and for comparison inserts
+//    the rendered events into per-channel multimaps, the container
+//    used before EventsChannel; run manually with --gtest_also_run_disabled_tests
+//---------------------------------------------------------
+
+TEST_F(MidiRenderer_Tests, DISABLED_renderBenchmark)
+{
+    MasterScore* score = ScoreRW::readScore(u"concertpitch_data/concertpitchbenchmark.mscx");
+    ASSERT_TRUE(score);
+
+    CompatMidiRendererInternal::Context ctx;
+    ctx.metronome = false;
+
+    static constexpr int RUNS = 10;
+
+    int64_t renderUs = 0;
+    int64_t multimapUs = 0;
+    size_t eventCount = 0;
+
+    for (int run = 0; run < RUNS; ++run) {
+        EventsHolder events;
+
+        auto start = std::chrono::steady_clock::now();
+        CompatMidiRender::renderScore(score, events, ctx, true);
+        // access sorts the channels, as the MIDI export and the playback do
+        eventCount = 0;
+        for (size_t i = 0; i < events.size(); ++i) {
+            eventCount += events[i].size();
+            events[i].begin();
+        }
+        renderUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        std::vector<std::multimap<int, NPlayEvent> > maps(events.size());
+        for (size_t i = 0; i < events.size(); ++i) {
+            for (const auto& ev : events[i]) {
+                maps[i].insert(ev);
+            }
+        }
+        multimapUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    LOGI() << "rendered " << eventCount << " events in " << renderUs / RUNS / 1000 << " ms on average"
+           << ", inserting them into multimaps takes " << multimapUs / RUNS / 1000 << " ms";
+
+    delete score;
+}
@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "dom/breath.h"
 #include "dom/chord.h"
 #include "dom/chordline.h"
@@ -42,6 +44,8 @@
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -274,6 +278,85 @@ TEST_F(Engraving_PartsTests, insertMeasure)
     delete score;
 }
 
+//---------------------------------------------------------
+//   createExcerptsBatch
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, createExcerptsBatch)
+{
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+    ASSERT_TRUE(score);
+
+    std::vector<Excerpt*> excerpts;
+    for (size_t i = 0; i < 2; ++i) {
+        Part* part = score->parts().at(i);
+
+        Excerpt* ex = new Excerpt(score);
+        ex->setExcerptScore(score->createScore());
+        ex->setParts({ part });
+        ex->setName(part->partName());
+        excerpts.push_back(ex);
+    }
+
+    Excerpt::createExcerpts(excerpts);
+
+    for (Excerpt* ex : excerpts) {
+        EXPECT_TRUE(ex->excerptScore());
+        score->excerpts().push_back(ex);
+    }
+    score->setExcerptsChanged(true);
+
+    // a batch must produce exactly the same parts as creating them one by one
+    EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"part-all-parts.mscx", PARTS_DATA_DIR + u"part-all-parts.mscx"));
+    delete score;
+}
+
+//---------------------------------------------------------
+//   createExcerptsBenchmark
+//    generates parts for all instruments of the largest
+//    test score, one by one as before the batches and in
+//    one batch, run manually with --gtest_also_run_disabled_tests
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, DISABLED_createExcerptsBenchmark)
+{
+    auto createAllParts = [](bool batch) {
+        MasterScore* score = ScoreRW::readScore(u"concertpitch_data/concertpitchbenchmark.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return int64_t(0);
+        }
+
+        std::vector<Excerpt*> excerpts = Excerpt::createExcerptsFromParts(score->parts(), score);
+
+        auto start = std::chrono::steady_clock::now();
+        if (batch) {
+            score->initExcerpts(excerpts);
+        } else {
+            for (Excerpt* ex : excerpts) {
+                score->initExcerpt(ex);
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        LOGI() << "created " << excerpts.size() << " parts " << (batch ? "in one batch" : "one by one")
+               << " in " << elapsed.count() << " ms";
+
+        for (Excerpt* ex : excerpts) {
+            EXPECT_TRUE(ex->inited());
+            score->excerpts().push_back(ex);
+        }
+
+        delete score;
+        return static_cast<int64_t>(elapsed.count());
+    };
+
+    const int64_t serialMs = createAllParts(false);
+    const int64_t batchMs = createAllParts(true);
+
+    LOGI() << "one by one: " << serialMs << " ms, batch: " << batchMs << " ms";
+}
+
 //---------------------------------------------------------
 //   styleScore
 //---------------------------------------------------------
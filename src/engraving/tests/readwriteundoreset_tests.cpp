@@ -101,3 +101,84 @@ TEST_F(Engraving_ReadWriteUndoResetTests, testMMRestLinksRecreateMMRest)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   testUndoMemoryBudget
+///   Once the undo history exceeds the memory budget,
+///   the oldest macros are released and can't be undone
+///   anymore, while the most recent one is always kept.
+//---------------------------------------------------------
+
+TEST_F(Engraving_ReadWriteUndoResetTests, testUndoMemoryBudget)
+{
+    MasterScore* score = ScoreRW::readScore(RWUNDORESET_DATA_DIR + u"barlines.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    MScore::undoMemoryBudget = 1;
+
+    for (int i = 0; i < 3; ++i) {
+        score->startCmd();
+        score->insertMeasure(nullptr);
+        score->endCmd();
+    }
+
+    EXPECT_GE(undoStack->releasedCount(), 2u);
+    EXPECT_GT(undoStack->memoryUsage(), 0u);
+
+    EXPECT_TRUE(undoStack->canUndo());
+    score->undoRedo(/* undo */ true, nullptr);
+    EXPECT_FALSE(undoStack->canUndo());
+    EXPECT_TRUE(undoStack->canRedo());
+
+    MScore::undoMemoryBudget = 0;
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   testUndoMemoryBudgetReleaseFloor
+///   Macros that may still be merged, as during text editing,
+///   are kept whatever the memory budget.
+//---------------------------------------------------------
+
+TEST_F(Engraving_ReadWriteUndoResetTests, testUndoMemoryBudgetReleaseFloor)
+{
+    MasterScore* score = ScoreRW::readScore(RWUNDORESET_DATA_DIR + u"barlines.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    MScore::undoMemoryBudget = 1;
+
+    score->startCmd();
+    score->insertMeasure(nullptr);
+    score->endCmd();
+
+    const size_t floor = undoStack->getCurIdx();
+    undoStack->setReleaseFloor(floor);
+
+    for (int i = 0; i < 3; ++i) {
+        score->startCmd();
+        score->insertMeasure(nullptr);
+        score->endCmd();
+    }
+
+    EXPECT_LE(undoStack->releasedCount(), floor);
+
+    undoStack->mergeCommands(floor);
+    undoStack->setReleaseFloor(mu::nidx);
+    EXPECT_EQ(undoStack->getCurIdx(), floor + 1);
+    ASSERT_TRUE(undoStack->last());
+    EXPECT_TRUE(undoStack->canUndo());
+
+    // without the floor the history is trimmed again by the next command
+    score->startCmd();
+    score->insertMeasure(nullptr);
+    score->endCmd();
+    EXPECT_EQ(undoStack->releasedCount(), undoStack->getCurIdx() - 1);
+    EXPECT_EQ(undoStack->prev(), nullptr);
+
+    MScore::undoMemoryBudget = 0;
+
+    delete score;
+}
@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "engraving/infrastructure/rtree.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_RTreeTests : public ::testing::Test
+{
+};
+
+static std::vector<int> queryTree(const RTree<int>& tree, const RectF& rect)
+{
+    std::vector<int> result;
+    tree.forEachIntersecting(rect, [&result](int value, const RectF&) {
+        result.push_back(value);
+    });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+static std::vector<int> queryBruteForce(const std::vector<RectF>& rects, const std::vector<bool>& present, const RectF& rect)
+{
+    std::vector<int> result;
+    for (size_t i = 0; i < rects.size(); ++i) {
+        const RectF& r = rects[i];
+        if (present[i] && r.left() <= rect.right() && rect.left() <= r.right() && r.top() <= rect.bottom() && rect.top() <= r.bottom()) {
+            result.push_back(static_cast<int>(i));
+        }
+    }
+    return result;
+}
+
+static RectF randomRect(std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> pos(0.0, 1000.0);
+    std::uniform_real_distribution<double> size(0.0, 50.0);
+    return RectF(pos(gen), pos(gen), size(gen), size(gen));
+}
+
+TEST_F(Engraving_RTreeTests, InsertRemoveUpdate)
+{
+    //! GIVEN Tree with many random rects
+    std::mt19937 gen(42);
+    const size_t count = 2000;
+
+    std::vector<RectF> rects;
+    std::vector<bool> present(count, true);
+
+    RTree<int> tree;
+    for (size_t i = 0; i < count; ++i) {
+        rects.push_back(randomRect(gen));
+        tree.insert(static_cast<int>(i), rects.back());
+    }
+
+    EXPECT_EQ(tree.size(), count);
+
+    std::vector<RectF> queries;
+    for (int i = 0; i < 50; ++i) {
+        queries.push_back(randomRect(gen).adjusted(-100, -100, 100, 100));
+    }
+
+    //! CHECK The same values are found as by checking every rect
+    for (const RectF& q : queries) {
+        EXPECT_EQ(queryTree(tree, q), queryBruteForce(rects, present, q));
+    }
+
+    //! DO Remove every third value and move every fifth one
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 3 == 0) {
+            EXPECT_TRUE(tree.remove(static_cast<int>(i)));
+            present[i] = false;
+        } else if (i % 5 == 0) {
+            rects[i] = randomRect(gen);
+            EXPECT_TRUE(tree.update(static_cast<int>(i), rects[i]));
+        }
+    }
+
+    //! CHECK Updating with the same rect changes nothing
+    EXPECT_FALSE(tree.update(1, rects[1]));
+
+    //! CHECK The tree is still consistent
+    EXPECT_FALSE(tree.contains(0));
+    EXPECT_TRUE(tree.contains(1));
+    EXPECT_EQ(tree.size(), static_cast<size_t>(std::count(present.begin(), present.end(), true)));
+
+    for (const RectF& q : queries) {
+        EXPECT_EQ(queryTree(tree, q), queryBruteForce(rects, present, q));
+    }
+
+    //! DO Remove everything
+    for (size_t i = 0; i < count; ++i) {
+        if (present[i]) {
+            EXPECT_TRUE(tree.remove(static_cast<int>(i)));
+        }
+    }
+
+    //! CHECK
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(queryTree(tree, RectF(0, 0, 1000, 1000)).empty());
+}
+
+TEST_F(Engraving_RTreeTests, EmptyRects)
+{
+    //! GIVEN Rects without width or height, like straight lines
+    RTree<int> tree;
+    tree.insert(1, RectF(10, 10, 100, 0));
+    tree.insert(2, RectF(10, 10, 0, 100));
+
+    //! CHECK They are found too
+    EXPECT_EQ(queryTree(tree, RectF(50, 5, 10, 10)), std::vector<int>({ 1 }));
+    EXPECT_EQ(queryTree(tree, RectF(5, 50, 10, 10)), std::vector<int>({ 2 }));
+}
@@ -31,6 +31,7 @@
 #include "dom/masterscore.h"
 #include "dom/measure.h"
 #include "dom/part.h"
+#include "dom/pedal.h"
 #include "dom/staff.h"
 #include "dom/system.h"
 #include "dom/undo.h"
@@ -593,3 +594,135 @@ TEST_F(Engraving_SpannersTests, spanners16)
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"smallstaff01.mscx", SPANNERS_DATA_DIR + u"smallstaff01-ref.mscx"));
     delete score;
 }
+
+//---------------------------------------------------------
+///  spannerMapIncremental
+///   adding and removing spanners updates the lookup trees
+///   of the spanner map without rebuilding them
+//---------------------------------------------------------
+
+TEST_F(Engraving_SpannersTests, spannerMapIncremental)
+{
+    MasterScore* score = ScoreRW::readScore(SPANNERS_DATA_DIR + u"glissando01.mscx");
+    EXPECT_TRUE(score);
+
+    Pedal* pedal1 = Factory::createPedal(score->dummy());
+    pedal1->setTrack(0);
+    pedal1->setTrack2(0);
+    pedal1->setTick(Fraction(0, 1));
+    pedal1->setTicks(Fraction(1, 1));
+
+    Pedal* pedal2 = Factory::createPedal(score->dummy());
+    pedal2->setTrack(0);
+    pedal2->setTrack2(0);
+    pedal2->setTick(Fraction(1, 2));
+    pedal2->setTicks(Fraction(1, 1));
+
+    const SpannerMap& spannerMap = score->spannerMap();
+    spannerMap.findOverlapping(0, 0);
+    spannerMap.resetStats();
+
+    score->addSpanner(pedal1);
+    score->addSpanner(pedal2);
+
+    const int tick = Fraction(3, 4).ticks();
+
+    auto containsPedal = [](const SpannerMap::IntervalList& intervals, const Pedal* pedal) {
+        for (const auto& interval : intervals) {
+            if (interval.value == pedal) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // both pedals overlap the tick, but the first one is trimmed in the collision free tree
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick), pedal1));
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick), pedal2));
+    EXPECT_FALSE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal1));
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal2));
+
+    // shortening the second pedal must not touch the first one
+    pedal2->setTicks(Fraction(1, 4));
+    EXPECT_FALSE(containsPedal(spannerMap.findOverlapping(tick + 1, tick + 1), pedal2));
+
+    // without the second pedal, the first one is no longer trimmed
+    score->removeSpanner(pedal2);
+    EXPECT_FALSE(containsPedal(spannerMap.findOverlapping(tick, tick), pedal2));
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal1));
+
+    EXPECT_EQ(spannerMap.stats().fullRebuilds, 0u);
+    EXPECT_EQ(spannerMap.stats().incrementalUpdates, 4u);
+
+    score->removeSpanner(pedal1);
+
+    delete pedal1;
+    delete pedal2;
+    delete score;
+}
+
+//---------------------------------------------------------
+///  spannerMapTrackChanged
+///   a spanner moved to another part is trimmed against
+///   the spanners of its new part only
+//---------------------------------------------------------
+
+TEST_F(Engraving_SpannersTests, spannerMapTrackChanged)
+{
+    MasterScore* score = ScoreRW::readScore(SPANNERS_DATA_DIR + u"spannermap-parts.mscx");
+    EXPECT_TRUE(score);
+
+    const track_idx_t secondPartTrack = score->staff(1)->part()->startTrack();
+    EXPECT_NE(score->staff(0)->part(), score->staff(1)->part());
+
+    Pedal* pedal1 = Factory::createPedal(score->dummy());
+    pedal1->setTrack(0);
+    pedal1->setTrack2(0);
+    pedal1->setTick(Fraction(0, 1));
+    pedal1->setTicks(Fraction(1, 1));
+
+    Pedal* pedal2 = Factory::createPedal(score->dummy());
+    pedal2->setTrack(secondPartTrack);
+    pedal2->setTrack2(secondPartTrack);
+    pedal2->setTick(Fraction(1, 2));
+    pedal2->setTicks(Fraction(1, 1));
+
+    const SpannerMap& spannerMap = score->spannerMap();
+    spannerMap.findOverlapping(0, 0);
+    spannerMap.resetStats();
+
+    score->addSpanner(pedal1);
+    score->addSpanner(pedal2);
+
+    const int tick = Fraction(3, 4).ticks();
+
+    auto containsPedal = [](const SpannerMap::IntervalList& intervals, const Pedal* pedal) {
+        for (const auto& interval : intervals) {
+            if (interval.value == pedal) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // the pedals are in different parts, so the first one is not trimmed
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal1));
+
+    // in the same part the first pedal is trimmed by the second one
+    pedal2->setTrack(0);
+    EXPECT_FALSE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal1));
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal2));
+
+    // and no longer once the second pedal is moved back
+    pedal2->setTrack(secondPartTrack);
+    EXPECT_TRUE(containsPedal(spannerMap.findOverlapping(tick, tick, true), pedal1));
+
+    EXPECT_EQ(spannerMap.stats().fullRebuilds, 0u);
+
+    score->removeSpanner(pedal1);
+    score->removeSpanner(pedal2);
+
+    delete pedal1;
+    delete pedal2;
+    delete score;
+}
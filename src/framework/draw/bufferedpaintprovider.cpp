@@ -311,6 +311,13 @@ void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     drawText(point, String::fromUcs4(&ucs4Code, 1));
 }
 
+void BufferedPaintProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        drawSymbol(points[i], ucs4Codes[i]);
+    }
+}
+
 void BufferedPaintProvider::drawPixmap(const PointF& p, const Pixmap& pm)
 {
     editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
@@ -0,0 +1,337 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "displaylistrecorder.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+static const int MAX_OPAQUE_ALPHA = 255;
+
+DisplayListRecorder::DisplayListRecorder(const DrawData::State& initialState)
+{
+    m_list = std::make_shared<DisplayList>();
+    m_list->recordTransformInverted = initialState.transform.inverted();
+    m_state.state = initialState;
+}
+
+bool DisplayListRecorder::isActive() const
+{
+    return m_isActive;
+}
+
+void DisplayListRecorder::beginTarget(const std::string&)
+{
+    m_isActive = true;
+}
+
+void DisplayListRecorder::beforeEndTargetHook(Painter*)
+{
+}
+
+bool DisplayListRecorder::endTarget(bool)
+{
+    m_isActive = false;
+    return true;
+}
+
+void DisplayListRecorder::beginObject(const std::string&)
+{
+}
+
+void DisplayListRecorder::endObject()
+{
+}
+
+DisplayList::State& DisplayListRecorder::editableState()
+{
+    m_isStateChanged = true;
+    return m_state;
+}
+
+void DisplayListRecorder::ensureStateEmitted()
+{
+    if (!m_isStateChanged) {
+        return;
+    }
+
+    m_isStateChanged = false;
+
+    if (m_emittedStateIndex >= 0 && m_list->states.at(m_emittedStateIndex) == m_state) {
+        return;
+    }
+
+    m_emittedStateIndex = static_cast<int>(m_list->states.size());
+    m_list->states.push_back(m_state);
+    addOp(DisplayList::OpType::State, m_emittedStateIndex);
+}
+
+void DisplayListRecorder::addOp(DisplayList::OpType type, size_t index)
+{
+    m_list->ops.push_back({ type, index });
+}
+
+bool DisplayListRecorder::canJoin(DisplayList::OpType type)
+{
+    //! NOTE Only directly consecutive calls with the same state are joined,
+    //! so the painting order is kept
+    if (m_list->ops.empty() || m_list->ops.back().type != type) {
+        return false;
+    }
+
+    if (m_isStateChanged) {
+        if (m_list->states.at(m_emittedStateIndex) != m_state) {
+            return false;
+        }
+        m_isStateChanged = false;
+    }
+
+    return true;
+}
+
+void DisplayListRecorder::setAntialiasing(bool arg)
+{
+    DisplayList::State& st = editableState();
+    st.state.isAntialiasing = arg;
+    st.fields |= DisplayList::AntialiasingField;
+}
+
+void DisplayListRecorder::setCompositionMode(CompositionMode mode)
+{
+    DisplayList::State& st = editableState();
+    st.state.compositionMode = mode;
+    st.fields |= DisplayList::CompositionModeField;
+}
+
+void DisplayListRecorder::setWindow(const RectF&)
+{
+    //! NOTE The view transform comes with the transform
+}
+
+void DisplayListRecorder::setViewport(const RectF&)
+{
+    //! NOTE The view transform comes with the transform
+}
+
+void DisplayListRecorder::setFont(const Font& font)
+{
+    DisplayList::State& st = editableState();
+    st.state.font = font;
+    st.fields |= DisplayList::FontField;
+}
+
+const Font& DisplayListRecorder::font() const
+{
+    return m_state.state.font;
+}
+
+void DisplayListRecorder::setPen(const Pen& pen)
+{
+    DisplayList::State& st = editableState();
+    st.state.pen = pen;
+    st.fields |= DisplayList::PenField;
+}
+
+void DisplayListRecorder::setNoPen()
+{
+    setPen(Pen(PenStyle::NoPen));
+}
+
+const Pen& DisplayListRecorder::pen() const
+{
+    return m_state.state.pen;
+}
+
+void DisplayListRecorder::setBrush(const Brush& brush)
+{
+    DisplayList::State& st = editableState();
+    st.state.brush = brush;
+    st.fields |= DisplayList::BrushField;
+}
+
+const Brush& DisplayListRecorder::brush() const
+{
+    return m_state.state.brush;
+}
+
+void DisplayListRecorder::save()
+{
+    m_savedStates.push({ m_state, m_emittedStateIndex, m_hasClipping });
+    addOp(DisplayList::OpType::Save, 0);
+}
+
+void DisplayListRecorder::restore()
+{
+    IF_ASSERT_FAILED(!m_savedStates.empty()) {
+        return;
+    }
+
+    const SavedState& saved = m_savedStates.top();
+    m_state = saved.state;
+    m_emittedStateIndex = saved.emittedStateIndex;
+    m_hasClipping = saved.hasClipping;
+    m_savedStates.pop();
+
+    //! NOTE The painter restores its own state, the transform is reapplied with the next state
+    m_isStateChanged = true;
+    addOp(DisplayList::OpType::Restore, 0);
+}
+
+void DisplayListRecorder::setTransform(const Transform& transform)
+{
+    editableState().state.transform = transform;
+}
+
+const Transform& DisplayListRecorder::transform() const
+{
+    return m_state.state.transform;
+}
+
+void DisplayListRecorder::drawPath(const PainterPath& path)
+{
+    ensureStateEmitted();
+    m_list->paths.push_back(path);
+    addOp(DisplayList::OpType::Path, m_list->paths.size() - 1);
+}
+
+void DisplayListRecorder::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
+{
+    //! NOTE Lines (drawLine, drawLines) come here as two point polylines,
+    //! with a solid opaque pen the overlaps are invisible, so they are stroked as one path
+    const Pen& pen = m_state.state.pen;
+    bool isLine = mode == PolygonMode::Polyline && pointCount == 2
+                  && pen.style() == PenStyle::SolidLine && pen.color().alpha() == MAX_OPAQUE_ALPHA;
+
+    if (isLine) {
+        if (!canJoin(DisplayList::OpType::Lines)) {
+            ensureStateEmitted();
+            m_list->paths.emplace_back();
+            addOp(DisplayList::OpType::Lines, m_list->paths.size() - 1);
+        }
+
+        PainterPath& lines = m_list->paths.at(m_list->ops.back().index);
+        lines.moveTo(points[0]);
+        lines.lineTo(points[1]);
+        return;
+    }
+
+    ensureStateEmitted();
+
+    PolygonF pol(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        pol[i] = points[i];
+    }
+    m_list->polygons.push_back(DrawPolygon { pol, mode });
+    addOp(DisplayList::OpType::Polygon, m_list->polygons.size() - 1);
+}
+
+void DisplayListRecorder::drawText(const PointF& point, const String& text)
+{
+    ensureStateEmitted();
+
+    m_list->texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
+    addOp(DisplayList::OpType::Text, m_list->texts.size() - 1);
+}
+
+void DisplayListRecorder::drawText(const RectF& rect, int flags, const String& text)
+{
+    ensureStateEmitted();
+
+    m_list->texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
+    addOp(DisplayList::OpType::Text, m_list->texts.size() - 1);
+}
+
+void DisplayListRecorder::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
+{
+    ensureStateEmitted();
+    m_list->workaroundTexts.push_back(DisplayList::TextWorkaround { f, pos, text });
+    addOp(DisplayList::OpType::TextWorkaround, m_list->workaroundTexts.size() - 1);
+}
+
+void DisplayListRecorder::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    if (!canJoin(DisplayList::OpType::GlyphRun)) {
+        ensureStateEmitted();
+        m_list->glyphRuns.emplace_back();
+        addOp(DisplayList::OpType::GlyphRun, m_list->glyphRuns.size() - 1);
+    }
+
+    DisplayList::GlyphRun& run = m_list->glyphRuns.at(m_list->ops.back().index);
+    run.points.push_back(point);
+    run.codes.push_back(ucs4Code);
+}
+
+void DisplayListRecorder::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        drawSymbol(points[i], ucs4Codes[i]);
+    }
+}
+
+void DisplayListRecorder::drawPixmap(const PointF&, const Pixmap&)
+{
+    m_list->isReplayable = false;
+}
+
+void DisplayListRecorder::drawTiledPixmap(const RectF&, const Pixmap&, const PointF&)
+{
+    m_list->isReplayable = false;
+}
+
+#ifndef NO_QT_SUPPORT
+void DisplayListRecorder::drawPixmap(const PointF&, const QPixmap&)
+{
+    m_list->isReplayable = false;
+}
+
+void DisplayListRecorder::drawTiledPixmap(const RectF&, const QPixmap&, const PointF&)
+{
+    m_list->isReplayable = false;
+}
+
+#endif
+
+bool DisplayListRecorder::hasClipping() const
+{
+    return m_hasClipping;
+}
+
+void DisplayListRecorder::setClipRect(const RectF& rect)
+{
+    //! NOTE The clip rect is in the current coordinates
+    ensureStateEmitted();
+    m_hasClipping = true;
+    m_list->clipRects.push_back(rect);
+    addOp(DisplayList::OpType::ClipRect, m_list->clipRects.size() - 1);
+}
+
+void DisplayListRecorder::setClipping(bool enable)
+{
+    m_hasClipping = enable;
+    addOp(DisplayList::OpType::Clipping, enable ? 1 : 0);
+}
+
+std::shared_ptr<DisplayList> DisplayListRecorder::displayList() const
+{
+    return m_list;
+}
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DISPLAYLISTRECORDER_H
+#define MU_DRAW_DISPLAYLISTRECORDER_H
+
+#include <stack>
+
+#include "ipaintprovider.h"
+#include "types/displaylist.h"
+
+namespace mu::draw {
+class DisplayListRecorder : public IPaintProvider
+{
+public:
+    //! NOTE initialState is what the recorded calls query before setting anything,
+    //! usually the current state of the painter the list will be replayed on
+    DisplayListRecorder(const DrawData::State& initialState = DrawData::State());
+
+    bool isActive() const override;
+    void beginTarget(const std::string& name) override;
+    void beforeEndTargetHook(Painter* painter) override;
+    bool endTarget(bool endDraw = false) override;
+
+    void beginObject(const std::string& name) override;
+    void endObject() override;
+
+    void setAntialiasing(bool arg) override;
+    void setCompositionMode(CompositionMode mode) override;
+    void setWindow(const RectF& window) override;
+    void setViewport(const RectF& viewport) override;
+
+    void setFont(const Font& font) override;
+    const Font& font() const override;
+
+    void setPen(const Pen& pen) override;
+    void setNoPen() override;
+    const Pen& pen() const override;
+
+    void setBrush(const Brush& brush) override;
+    const Brush& brush() const override;
+
+    void save() override;
+    void restore() override;
+
+    void setTransform(const Transform& transform) override;
+    const Transform& transform() const override;
+
+    // drawing functions
+    void drawPath(const PainterPath& path) override;
+    void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override;
+
+    void drawText(const PointF& point, const String& text) override;
+    void drawText(const RectF& rect, int flags, const String& text) override;
+    void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
+
+    void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
+
+    void drawPixmap(const PointF& p, const Pixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
+
+#ifndef NO_QT_SUPPORT
+    void drawPixmap(const PointF& point, const QPixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset = PointF()) override;
+#endif
+
+    bool hasClipping() const override;
+
+    void setClipRect(const RectF& rect) override;
+    void setClipping(bool enable) override;
+
+    // ---
+
+    std::shared_ptr<DisplayList> displayList() const;
+
+private:
+    struct SavedState {
+        DisplayList::State state;
+        int emittedStateIndex = -1;
+        bool hasClipping = false;
+    };
+
+    DisplayList::State& editableState();
+    void ensureStateEmitted();
+    void addOp(DisplayList::OpType type, size_t index);
+    bool canJoin(DisplayList::OpType type);
+
+    std::shared_ptr<DisplayList> m_list;
+
+    DisplayList::State m_state;
+    bool m_isStateChanged = true;
+    int m_emittedStateIndex = -1;
+    bool m_hasClipping = false;
+    bool m_isActive = false;
+
+    std::stack<SavedState> m_savedStates;
+};
+}
+
+#endif // MU_DRAW_DISPLAYLISTRECORDER_H
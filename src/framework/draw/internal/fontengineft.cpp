@@ -21,7 +21,9 @@
  */
 #include "fontengineft.h"
 
-#include <QHash>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "io/file.h"
 
@@ -49,19 +51,48 @@ static bool _init_ft()
     return error == 0;
 }
 
+//! NOTE SMuFL glyphs are in the Private Use Area of the BMP
+static constexpr char32_t SMUFL_FIRST_CODE = 0xE000;
+static constexpr char32_t SMUFL_LAST_CODE = 0xF8FF;
+
 struct mu::draw::FTGlyphMetrics
 {
-    FT_BBox bb;
+    FT_BBox bb = { 0, 0, 0, 0 };
     double linearHoriAdvance = 0.0;
+    bool isValid = false;
 };
 
 struct mu::draw::FTData
 {
     ByteArray fontData;
     FT_Face face = nullptr;
-    QHash<char32_t, FTGlyphMetrics> metrics;
+
+    //! NOTE Filled once on load and never changed after, so it is read without locking
+    std::vector<FTGlyphMetrics> smuflMetrics;
+
+    //! NOTE Other code points are loaded on demand, the face is not thread safe
+    std::mutex mutex;
+    std::unordered_map<char32_t, FTGlyphMetrics> metrics;
 };
 
+static bool loadGlyphMetrics(FT_Face face, FT_UInt index, FTGlyphMetrics& gm)
+{
+    if (FT_Load_Glyph(face, index, FT_LOAD_DEFAULT) != 0) {
+        return false;
+    }
+
+    FT_BBox bb;
+    if (FT_Outline_Get_BBox(&face->glyph->outline, &bb) != 0) {
+        return false;
+    }
+
+    gm.bb = bb;
+    gm.linearHoriAdvance = face->glyph->linearHoriAdvance;
+    gm.isValid = true;
+
+    return true;
+}
+
 FontEngineFT::FontEngineFT()
 {
     m_data = new FTData();
@@ -96,12 +127,29 @@ bool FontEngineFT::load(const io::path_t& path)
     double pixelSize = 200.0;
     FT_Set_Pixel_Sizes(m_data->face, 0, int(pixelSize + .5));
 
+    loadSmuflMetrics();
+
     return true;
 }
 
+void FontEngineFT::loadSmuflMetrics()
+{
+    TRACEFUNC;
+
+    m_data->smuflMetrics.assign(SMUFL_LAST_CODE - SMUFL_FIRST_CODE + 1, FTGlyphMetrics());
+
+    //! NOTE Only the code points present in the font are visited
+    FT_UInt index = 0;
+    FT_ULong code = FT_Get_Next_Char(m_data->face, SMUFL_FIRST_CODE - 1, &index);
+    while (index != 0 && code <= SMUFL_LAST_CODE) {
+        loadGlyphMetrics(m_data->face, index, m_data->smuflMetrics[code - SMUFL_FIRST_CODE]);
+        code = FT_Get_Next_Char(m_data->face, code, &index);
+    }
+}
+
 QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return QRectF();
     }
@@ -116,7 +164,7 @@ QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 
 double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return 0.0;
     }
@@ -125,29 +173,38 @@ double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
     return gm->linearHoriAdvance * dpi_f / 655360.0;
 }
 
-FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
+const FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
 {
-    if (m_data->metrics.contains(ucs4)) {
-        return &m_data->metrics[ucs4];
+    if (ucs4 >= SMUFL_FIRST_CODE && ucs4 <= SMUFL_LAST_CODE) {
+        if (m_data->smuflMetrics.empty()) {
+            return nullptr;
+        }
+
+        const FTGlyphMetrics& gm = m_data->smuflMetrics[ucs4 - SMUFL_FIRST_CODE];
+        return gm.isValid ? &gm : nullptr;
     }
 
-    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
-    if (index == 0) {
-        return nullptr;
+    std::lock_guard<std::mutex> lock(m_data->mutex);
+
+    auto it = m_data->metrics.find(ucs4);
+    if (it != m_data->metrics.end()) {
+        return &it->second;
     }
 
-    if (FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0) {
+    if (!m_data->face) {
         return nullptr;
     }
 
-    FT_BBox bb;
-    if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
+    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
+    if (index == 0) {
         return nullptr;
     }
 
-    FTGlyphMetrics& gm = m_data->metrics[ucs4];
-    gm.bb = bb;
-    gm.linearHoriAdvance = m_data->face->glyph->linearHoriAdvance;
+    FTGlyphMetrics gm;
+    if (!loadGlyphMetrics(m_data->face, index, gm)) {
+        return nullptr;
+    }
 
-    return &gm;
+    //! NOTE The elements of unordered_map are not moved on rehash
+    return &m_data->metrics.emplace(ucs4, gm).first->second;
 }
@@ -37,12 +37,15 @@ public:
 
     bool load(const io::path_t& path);
 
+    //! NOTE The metrics of the SMuFL range are read from a table filled on load,
+    //! so they can be queried from several threads at once
     QRectF bbox(char32_t ucs4, double DPI_F) const;
     double advance(char32_t ucs4, double DPI_F) const;
 
 private:
 
-    FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    void loadSmuflMetrics();
+    const FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
 
     FTData* m_data = nullptr;
 };
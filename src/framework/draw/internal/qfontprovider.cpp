@@ -204,6 +204,9 @@ FontEngineFT* QFontProvider::symEngine(const Font& f) const
         return nullptr;
     }
 
+    //! NOTE The engines are created on demand, the metrics may be requested from several threads
+    std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+
     FontEngineFT* engine = m_symEngines.value(path, nullptr);
     if (!engine) {
         engine = new FontEngineFT();
@@ -22,6 +22,8 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <mutex>
+
 #include <QHash>
 
 #include "../ifontprovider.h"
@@ -65,6 +67,7 @@ private:
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+    mutable std::mutex m_symEnginesMutex;
 };
 }
 
@@ -311,6 +311,61 @@ void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     drawText(point, cache.value(ucs4Code));
 }
 
+void QPainterProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    //! NOTE The raw font is resolved for the paint device, as the font of the painter would be
+    const QFont font(m_painter->font(), m_painter->device());
+    if (!m_rawFont.isValid() || m_rawFontSource != font) {
+        m_rawFont = QRawFont::fromFont(font);
+        m_rawFontSource = font;
+    }
+
+    //! NOTE One lookup for the whole run, there is one glyph index per code point
+    QVector<quint32> allIndexes;
+    if (m_rawFont.isValid()) {
+        allIndexes = m_rawFont.glyphIndexesForString(QString::fromUcs4(ucs4Codes, static_cast<int>(count)));
+    }
+    const bool hasIndexes = allIndexes.size() == static_cast<int>(count);
+
+    QVector<quint32> glyphIndexes;
+    QVector<QPointF> positions;
+    glyphIndexes.reserve(static_cast<int>(count));
+    positions.reserve(static_cast<int>(count));
+
+    auto drawGlyphRun = [this, &glyphIndexes, &positions]() {
+        if (glyphIndexes.empty()) {
+            return;
+        }
+
+        QGlyphRun glyphRun;
+        glyphRun.setRawFont(m_rawFont);
+        glyphRun.setGlyphIndexes(glyphIndexes);
+        glyphRun.setPositions(positions);
+
+        m_painter->drawGlyphRun(QPointF(), glyphRun);
+
+        glyphIndexes.clear();
+        positions.clear();
+    };
+
+    for (size_t i = 0; i < count; ++i) {
+        const quint32 index = hasIndexes ? allIndexes.at(static_cast<int>(i)) : 0;
+
+        //! NOTE Symbols missing in the font are drawn as text, so they get the font fallback.
+        //! The symbols before them are drawn first, to keep the paint order
+        if (index == 0) {
+            drawGlyphRun();
+            drawSymbol(points[i], ucs4Codes[i]);
+            continue;
+        }
+
+        glyphIndexes.push_back(index);
+        positions.push_back(points[i].toQPointF());
+    }
+
+    drawGlyphRun();
+}
+
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
     QString key = QString::number(pm.key());
@@ -22,6 +22,9 @@
 #ifndef MU_DRAW_QPAINTERPROVIDER_H
 #define MU_DRAW_QPAINTERPROVIDER_H
 
+#include <QFont>
+#include <QRawFont>
+
 #include "../ipaintprovider.h"
 
 class QPainter;
@@ -78,6 +81,7 @@ public:
     void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& point, const Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
@@ -101,6 +105,9 @@ private:
     Brush m_brush;
 
     Transform m_transform;
+
+    QFont m_rawFontSource;
+    QRawFont m_rawFont;
 };
 }
 
@@ -157,6 +157,10 @@ public:
 
     void drawSymbol(const PointF& point, char32_t ucs4Code);
 
+    //! NOTE Draws all the symbols with the current font and pen at once,
+    //! for the paint devices this is much cheaper than drawing them one by one
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count);
+
     void fillRect(const RectF& rect, const Brush& brush);
 
     void drawPixmap(const PointF& point, const Pixmap& pm);
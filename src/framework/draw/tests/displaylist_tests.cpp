@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "draw/painter.h"
+#include "draw/displaylistrecorder.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/displaylistpaint.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_DisplayListTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Draw_DisplayListTests, Record_JoinsSymbolsAndLines)
+{
+    //! GIVEN Recorder
+    auto recorder = std::make_shared<DisplayListRecorder>();
+    {
+        Painter painter(recorder, "record");
+
+        //! DO Draw symbols and lines with the same state, the pen is set again with the same value
+        painter.setPen(Pen(Color(0, 0, 0), 1.0));
+        painter.drawSymbol(PointF(0, 0), 0xE050);
+        painter.drawSymbol(PointF(10, 0), 0xE050);
+        painter.setPen(Pen(Color(0, 0, 0), 1.0));
+        painter.drawSymbol(PointF(20, 0), 0xE062);
+
+        painter.drawLine(PointF(0, 0), PointF(100, 0));
+        painter.drawLine(PointF(0, 10), PointF(100, 10));
+
+        //! DO Change the state
+        painter.translate(5, 5);
+        painter.drawSymbol(PointF(0, 0), 0xE050);
+    }
+
+    std::shared_ptr<DisplayList> list = recorder->displayList();
+
+    //! CHECK Consecutive calls are joined, the order is kept
+    ASSERT_EQ(list->glyphRuns.size(), 2u);
+    EXPECT_EQ(list->glyphRuns.at(0).codes.size(), 3u);
+    EXPECT_EQ(list->glyphRuns.at(1).codes.size(), 1u);
+
+    ASSERT_EQ(list->paths.size(), 1u);
+    EXPECT_TRUE(list->polygons.empty());
+
+    ASSERT_EQ(list->states.size(), 2u);
+    EXPECT_EQ(list->states.at(1).state.transform, Transform().translate(5, 5));
+
+    std::vector<DisplayList::OpType> expectedOps = {
+        DisplayList::OpType::State,
+        DisplayList::OpType::GlyphRun,
+        DisplayList::OpType::Lines,
+        DisplayList::OpType::State,
+        DisplayList::OpType::GlyphRun
+    };
+
+    ASSERT_EQ(list->ops.size(), expectedOps.size());
+    for (size_t i = 0; i < expectedOps.size(); ++i) {
+        EXPECT_EQ(list->ops.at(i).type, expectedOps.at(i));
+    }
+}
+
+TEST_F(Draw_DisplayListTests, Replay_UsesCurrentTransform)
+{
+    //! GIVEN List recorded with a scaled painter
+    DrawData::State initialState;
+    initialState.transform = Transform().scale(0.5, 0.5);
+
+    auto recorder = std::make_shared<DisplayListRecorder>(initialState);
+    {
+        Painter painter(recorder, "record");
+        painter.translate(10, 20);
+        painter.drawText(PointF(1, 2), u"text");
+    }
+
+    //! DO Replay it on a painter with another transform
+    auto buffer = std::make_shared<BufferedPaintProvider>();
+    Painter painter(buffer, "replay");
+    painter.setWorldTransform(Transform().translate(100, 200));
+
+    DisplayListPaint::paint(&painter, *recorder->displayList());
+
+    //! CHECK The text is drawn as if it had been drawn on this painter
+    DrawDataPtr data = buffer->drawData();
+    auto drawn = std::find_if(data->item.datas.cbegin(), data->item.datas.cend(), [](const DrawData::Data& d) {
+        return !d.texts.empty();
+    });
+    ASSERT_NE(drawn, data->item.datas.cend());
+
+    ASSERT_EQ(drawn->texts.size(), 1u);
+    EXPECT_EQ(drawn->texts.at(0).text, u"text");
+    EXPECT_EQ(data->states.at(drawn->state).transform, Transform().translate(10, 20) * Transform().translate(100, 200));
+
+    //! CHECK The transform of the painter is not changed
+    EXPECT_EQ(painter.worldTransform(), Transform().translate(100, 200));
+}
@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DISPLAYLIST_H
+#define MU_DRAW_DISPLAYLIST_H
+
+#include <memory>
+#include <vector>
+
+#include "drawdata.h"
+
+namespace mu::draw {
+//! NOTE Compiled draw calls, recorded by DisplayListRecorder and replayed by DisplayListPaint.
+//! Unlike DrawData, which is meant for diagnostics, the order of the calls is kept,
+//! the state is only stored when it changes, consecutive symbols are joined into glyph runs
+//! and consecutive lines are joined into one path.
+struct DisplayList
+{
+    enum class OpType : unsigned char {
+        State = 0,
+        Save,
+        Restore,
+        Path,
+        Lines,
+        Polygon,
+        Text,
+        TextWorkaround,
+        GlyphRun,
+        ClipRect,
+        Clipping
+    };
+
+    struct Op {
+        OpType type = OpType::State;
+        size_t index = 0; // in the storage of the type, or the flag for Clipping
+    };
+
+    enum StateField : unsigned char {
+        PenField = 1 << 0,
+        BrushField = 1 << 1,
+        FontField = 1 << 2,
+        AntialiasingField = 1 << 3,
+        CompositionModeField = 1 << 4
+    };
+
+    //! NOTE Only the fields that were set while recording are applied,
+    //! the others are inherited from the painter, as they would be without the list
+    struct State {
+        DrawData::State state;
+        unsigned char fields = 0;
+
+        bool operator==(const State& o) const { return fields == o.fields && state == o.state; }
+        bool operator!=(const State& o) const { return !this->operator==(o); }
+    };
+
+    struct GlyphRun {
+        std::vector<PointF> points;
+        std::vector<char32_t> codes;
+    };
+
+    struct TextWorkaround {
+        Font font;
+        PointF pos;
+        String text;
+    };
+
+    std::vector<Op> ops;
+
+    std::vector<State> states;
+    std::vector<PainterPath> paths;
+    std::vector<DrawPolygon> polygons;
+    std::vector<DrawText> texts;
+    std::vector<TextWorkaround> workaroundTexts;
+    std::vector<GlyphRun> glyphRuns;
+    std::vector<RectF> clipRects;
+
+    //! NOTE Inverse of the transform the list was recorded with
+    Transform recordTransformInverted;
+
+    //! NOTE Set by the owner, to check whether the list was recorded for the current paint context
+    uint64_t key = 0;
+
+    //! NOTE Pixmaps are not recorded, a list that met them must not be replayed
+    bool isReplayable = true;
+
+    bool empty() const { return ops.empty(); }
+
+    //! NOTE Approximate heap usage, used to bound the memory of the cached lists
+    size_t memoryUsage() const
+    {
+        size_t bytes = sizeof(DisplayList)
+                       + ops.capacity() * sizeof(Op)
+                       + states.capacity() * sizeof(State)
+                       + paths.capacity() * sizeof(PainterPath)
+                       + polygons.capacity() * sizeof(DrawPolygon)
+                       + texts.capacity() * sizeof(DrawText)
+                       + workaroundTexts.capacity() * sizeof(TextWorkaround)
+                       + glyphRuns.capacity() * sizeof(GlyphRun)
+                       + clipRects.capacity() * sizeof(RectF);
+
+        for (const PainterPath& path : paths) {
+            bytes += path.elementCount() * sizeof(PainterPath::Element);
+        }
+        for (const DrawPolygon& polygon : polygons) {
+            bytes += polygon.polygon.size() * sizeof(PointF);
+        }
+        for (const DrawText& text : texts) {
+            bytes += text.text.size() * sizeof(char16_t);
+        }
+        for (const TextWorkaround& text : workaroundTexts) {
+            bytes += text.text.size() * sizeof(char16_t);
+        }
+        for (const GlyphRun& run : glyphRuns) {
+            bytes += run.points.capacity() * sizeof(PointF) + run.codes.capacity() * sizeof(char32_t);
+        }
+
+        return bytes;
+    }
+};
+
+using DisplayListPtr = std::shared_ptr<const DisplayList>;
+}
+
+#endif // MU_DRAW_DISPLAYLIST_H
@@ -0,0 +1,124 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "displaylistpaint.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+static void applyState(Painter* painter, const DisplayList::State& st, const Transform& baseTransform)
+{
+    if (st.fields & DisplayList::PenField) {
+        painter->setPen(st.state.pen);
+    }
+
+    if (st.fields & DisplayList::BrushField) {
+        painter->setBrush(st.state.brush);
+    }
+
+    if (st.fields & DisplayList::FontField) {
+        painter->setFont(st.state.font);
+    }
+
+    if (st.fields & DisplayList::AntialiasingField) {
+        painter->setAntialiasing(st.state.isAntialiasing);
+    }
+
+    if (st.fields & DisplayList::CompositionModeField) {
+        painter->setCompositionMode(st.state.compositionMode);
+    }
+
+    painter->setWorldTransform(st.state.transform * baseTransform);
+}
+
+void DisplayListPaint::paint(Painter* painter, const DisplayList& list)
+{
+    const Transform originalTransform = painter->worldTransform();
+
+    //! NOTE The recorded transforms include the transform of the recording,
+    //! it is replaced by the current transform of the painter
+    const Transform baseTransform = list.recordTransformInverted * originalTransform;
+
+    for (const DisplayList::Op& op : list.ops) {
+        switch (op.type) {
+        case DisplayList::OpType::State:
+            applyState(painter, list.states[op.index], baseTransform);
+            break;
+        case DisplayList::OpType::Save:
+            painter->save();
+            break;
+        case DisplayList::OpType::Restore:
+            painter->restore();
+            break;
+        case DisplayList::OpType::Path:
+            painter->drawPath(list.paths[op.index]);
+            break;
+        case DisplayList::OpType::Lines: {
+            Brush brush = painter->brush();
+            painter->setBrush(BrushStyle::NoBrush);
+            painter->drawPath(list.paths[op.index]);
+            painter->setBrush(brush);
+        } break;
+        case DisplayList::OpType::Polygon: {
+            const DrawPolygon& pl = list.polygons[op.index];
+            if (pl.polygon.empty()) {
+                break;
+            }
+
+            if (pl.mode == PolygonMode::Polyline) {
+                painter->drawPolyline(&pl.polygon[0], pl.polygon.size());
+            } else if (pl.mode == PolygonMode::Convex) {
+                painter->drawConvexPolygon(&pl.polygon[0], pl.polygon.size());
+            } else {
+                FillRule rule = (pl.mode == PolygonMode::OddEven) ? FillRule::OddEvenFill : FillRule::WindingFill;
+                painter->drawPolygon(&pl.polygon[0], pl.polygon.size(), rule);
+            }
+        } break;
+        case DisplayList::OpType::Text: {
+            const DrawText& t = list.texts[op.index];
+            if (t.mode == DrawText::Point) {
+                painter->drawText(t.rect.topLeft(), t.text);
+            } else {
+                painter->drawText(t.rect, t.flags, t.text);
+            }
+        } break;
+        case DisplayList::OpType::TextWorkaround: {
+            const DisplayList::TextWorkaround& t = list.workaroundTexts[op.index];
+            Font font = t.font;
+            painter->drawTextWorkaround(font, t.pos, t.text);
+        } break;
+        case DisplayList::OpType::GlyphRun: {
+            const DisplayList::GlyphRun& run = list.glyphRuns[op.index];
+            painter->drawSymbols(run.points.data(), run.codes.data(), run.codes.size());
+        } break;
+        case DisplayList::OpType::ClipRect:
+            painter->setClipRect(list.clipRects[op.index]);
+            break;
+        case DisplayList::OpType::Clipping:
+            painter->setClipping(op.index != 0);
+            break;
+        }
+    }
+
+    painter->setWorldTransform(originalTransform);
+}
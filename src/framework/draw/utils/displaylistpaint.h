@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DISPLAYLISTPAINT_H
+#define MU_DRAW_DISPLAYLISTPAINT_H
+
+#include "../painter.h"
+#include "../types/displaylist.h"
+
+namespace mu::draw {
+class DisplayListPaint
+{
+public:
+    DisplayListPaint() = default;
+
+    //! NOTE The list is painted in the current coordinates of the painter,
+    //! as if the calls were made on the painter instead of the recorder
+    static void paint(Painter* painter, const DisplayList& list);
+};
+}
+
+#endif // MU_DRAW_DISPLAYLISTPAINT_H
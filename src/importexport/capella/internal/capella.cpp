@@ -29,6 +29,7 @@
 #include <cmath>
 
 #include <QFile>
+#include <QVector>
 #include <QtMath>
 
 #include "translation.h"
@@ -402,24 +403,56 @@ Fraction TupletFractionCap(int tupletCount, bool tuplettrp, bool tupletprol)
     return Fraction(nn, dd);
 }
 
+//---------------------------------------------------------
+//   graceNumbers -- the grace note level before each object of a voice,
+//   as findChordRests counts it when it passes the object
+//---------------------------------------------------------
+
+static QVector<int> graceNumbers(const QList<NoteObj*>& objects)
+{
+    QVector<int> result;
+    result.reserve(objects.size());
+    int graceNumber = 0;
+    for (NoteObj* nobj : objects) {
+        result.push_back(graceNumber);
+        if (nobj->type() == CapellaNoteObjectType::REST) {
+            graceNumber = 0;
+        } else if (nobj->type() == CapellaNoteObjectType::CHORD) {
+            ChordObj* cho = static_cast<ChordObj*>(nobj);
+            if (!(cho->invisible) && (cho->ticks().isZero())) {     // grace note
+                ++graceNumber;
+            } else {
+                graceNumber = 0;
+            }
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------
 //   findChordRests -- find begin and end ChordRest for BasicDrawObj o
+//   attached to the object at index noIdx of objects,
+//   graceNumbers are the grace note levels of objects, see graceNumbers()
 //   return true on success (both begin and end found)
 //---------------------------------------------------------
 
 static bool findChordRests(BasicDrawObj const* const o, Score* score, const int track, const Fraction& tick,
-                           ChordRest*& cr1, ChordRest*& cr2, NoteObj* no, QList<NoteObj*> objects)
+                           ChordRest*& cr1, ChordRest*& cr2, const QList<NoteObj*>& objects, int noIdx,
+                           const QVector<int>& graceNumbers)
 {
     cr1 = 0;                           // ChordRest where BasicDrawObj o begins
     cr2 = 0;                           // ChordRest where BasicDrawObj o ends
 
     // find the ChordRests where o begins and ends
     int n = o->nNotes + 1;                                  // # notes in BasicDrawObj (nNotes is # notes following the first note)
-    int graceNumber = 0;
+    NoteObj* no = objects.at(noIdx);
+    // the objects before no only count grace notes, so start at no with the level counted up to it
+    int graceNumber = graceNumbers.at(noIdx);
     int graceNumber1 = 0;
     bool foundcr1 = false;
     Fraction tick2 = tick;
-    for (NoteObj* nobj : objects) {
+    for (int i = noIdx; i < objects.size(); ++i) {
+        NoteObj* nobj = objects.at(i);
         BasicDurationalObj* d = 0;
         if (nobj->type() == CapellaNoteObjectType::REST) {
             d = static_cast<BasicDurationalObj*>(static_cast<RestObj*>(nobj));
@@ -976,7 +1009,9 @@ static Fraction readCapVoice(Score* score, CapVoice* cvoice, int staffIdx, const
     // pass II
     //
     tick = startTick;
-    foreach (NoteObj* no, cvoice->objects) {
+    const QVector<int> voiceGraceNumbers = graceNumbers(cvoice->objects);
+    for (int noIdx = 0; noIdx < cvoice->objects.size(); ++noIdx) {
+        NoteObj* no = cvoice->objects.at(noIdx);
         BasicDurationalObj* d = 0;
         if (no->type() == CapellaNoteObjectType::REST) {
             d = static_cast<BasicDurationalObj*>(static_cast<RestObj*>(no));
@@ -1000,7 +1035,7 @@ static Fraction readCapVoice(Score* score, CapVoice* cvoice, int staffIdx, const
                 //        so->nDotDist, so->nDotWidth, so->nRefNote, so->nNotes);
                 ChordRest* cr1 = 0;               // ChordRest where slur begins
                 ChordRest* cr2 = 0;               // ChordRest where slur ends
-                bool res = findChordRests(o, score, track, tick, cr1, cr2, no, cvoice->objects);
+                bool res = findChordRests(o, score, track, tick, cr1, cr2, cvoice->objects, noIdx, voiceGraceNumbers);
 
                 if (res) {
                     if (cr1 == cr2) {
@@ -1046,7 +1081,7 @@ static Fraction readCapVoice(Score* score, CapVoice* cvoice, int staffIdx, const
                 VoltaObj* vo = static_cast<VoltaObj*>(o);
                 ChordRest* cr1 = 0;               // ChordRest where volta begins
                 ChordRest* cr2 = 0;               // ChordRest where volta ends
-                bool res = findChordRests(o, score, track, tick, cr1, cr2, no, cvoice->objects);
+                bool res = findChordRests(o, score, track, tick, cr1, cr2, cvoice->objects, noIdx, voiceGraceNumbers);
 
                 if (res) {
                     Volta* volta = Factory::createVolta(score->dummy());
@@ -1071,7 +1106,7 @@ static Fraction readCapVoice(Score* score, CapVoice* cvoice, int staffIdx, const
                 TrillObj* tro = static_cast<TrillObj*>(o);
                 ChordRest* cr1 = 0;               // ChordRest where trill line begins
                 ChordRest* cr2 = 0;               // ChordRest where trill line ends
-                bool res = findChordRests(o, score, track, tick, cr1, cr2, no, cvoice->objects);
+                bool res = findChordRests(o, score, track, tick, cr1, cr2, cvoice->objects, noIdx, voiceGraceNumbers);
                 if (res) {
                     if (cr1 == cr2) {
                         LOGD("first and second anchor for trill line identical (tick %d track %d first %p second %p)",
@@ -1095,7 +1130,7 @@ static Fraction readCapVoice(Score* score, CapVoice* cvoice, int staffIdx, const
                 WedgeObj* wdgo = static_cast<WedgeObj*>(o);
                 ChordRest* cr1 = 0;               // ChordRest where hairpin begins
                 ChordRest* cr2 = 0;               // ChordRest where hairpin ends
-                bool res = findChordRests(o, score, track, tick, cr1, cr2, no, cvoice->objects);
+                bool res = findChordRests(o, score, track, tick, cr1, cr2, cvoice->objects, noIdx, voiceGraceNumbers);
                 if (res) {
                     if (cr1 == cr2) {
                         LOGD("first and second anchor for hairpin identical (tick %d track %d first %p second %p)",
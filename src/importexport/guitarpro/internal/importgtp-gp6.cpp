@@ -22,6 +22,7 @@
 
 #include "importgtp.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "serialization/xmldom.h"
@@ -253,7 +254,7 @@ int GuitarPro6::readBit(ByteArray* buffer)
     int byteOffset = ((BITS_IN_BYTE - 1) - (position % BITS_IN_BYTE));
 
     // calculate the bit which we want to read
-    char byte = (byteIndex < buffer->size()) ? (*buffer)[byteIndex] : char(0);
+    char byte = (byteIndex < buffer->size()) ? buffer->constData()[byteIndex] : char(0);
     int bit = (((byte & 0xff) >> byteOffset) & 0x01);
 
     // increment our current position so we know this bit has been read
@@ -287,34 +288,20 @@ int GuitarPro6::readBitsReversed(ByteArray* buffer, int bitsToRead)
     return bits;
 }
 
-//---------------------------------------------------------
-//   getBytes
-//---------------------------------------------------------
-
-ByteArray GuitarPro6::getBytes(ByteArray* buffer, int offset, int length)
-{
-    ByteArray newBytes;
-    // compute new bytes from our buffer and return byte array
-    for (int i = 0; i < length; i++) {
-        if (static_cast<int>(buffer->size()) > offset + i) {
-            newBytes.insert(i, ((*buffer)[offset + i]));
-        }
-    }
-    return newBytes;
-}
-
 //---------------------------------------------------------
 //   readInteger
 //---------------------------------------------------------
 
 int GuitarPro6::readInteger(ByteArray* buffer, int offset)
 {
-    // assign four bytes and take them from the buffer
-    char bytes[4];
-    bytes[0] = (*buffer)[offset + 0];
-    bytes[1] = (*buffer)[offset + 1];
-    bytes[2] = (*buffer)[offset + 2];
-    bytes[3] = (*buffer)[offset + 3];
+    // assign four bytes and take them from the buffer, bytes past its end are read as zero
+    char bytes[4] = { 0, 0, 0, 0 };
+    if (offset >= 0) {
+        const size_t size = buffer->size();
+        for (size_t i = 0; i < 4 && offset + i < size; ++i) {
+            bytes[i] = buffer->constData()[offset + i];
+        }
+    }
     // increment positioning so we keep track of where we are
     position += sizeof(int) * BITS_IN_BYTE;
     // bit shift in order to compute our integer value and return
@@ -329,8 +316,8 @@ ByteArray GuitarPro6::readString(ByteArray* buffer, int offset, int length)
 {
     ByteArray filename;
     // compute the string by iterating through the buffer
-    for (int i = 0; i < length; i++) {
-        int charValue = (((*buffer)[offset + i]) & 0xff);
+    for (int i = 0; i < length && offset + i < static_cast<int>(buffer->size()); i++) {
+        int charValue = ((buffer->constData()[offset + i]) & 0xff);
         if (charValue == 0) {
             break;
         }
@@ -371,14 +358,21 @@ XmlDomNode GuitarPro6::getNode(const String& id, XmlDomNode currentDomNode)
 
 void GuitarPro6::readGpif(ByteArray* data)
 {
-    XmlDomDocument domDoc;
-    domDoc.setContent(*data);
-    XmlDomElement domElem = domDoc.rootElement();
-
-    auto builder = createGPDomBuilder();
-    builder->buildGPDomModel(&domElem);
+    std::unique_ptr<GPDomModel> gpDom;
+    {
+        //! NOTE The document keeps its own copy of the data, and neither of them
+        //! is needed by the converter, so they are released once the model is built
+        XmlDomDocument domDoc;
+        domDoc.setContent(*data);
+        *data = ByteArray();
+        XmlDomElement domElem = domDoc.rootElement();
+
+        auto builder = createGPDomBuilder();
+        builder->buildGPDomModel(&domElem);
+        gpDom = builder->getGPDomModel();
+    }
 
-    GPConverter scoreBuilder(score, builder->getGPDomModel());
+    GPConverter scoreBuilder(score, std::move(gpDom));
     scoreBuilder.convertGP();
 }
 
@@ -408,7 +402,6 @@ void GuitarPro6::readGPX(ByteArray* buffer)
         int length             = readInteger(buffer, position / BITS_IN_BYTE);
         ByteArray bcfsBuffer;
         bcfsBuffer.reserve(length);
-        int positionCounter    = 0;
         while ((position / BITS_IN_BYTE) < length) {
             // read the bit indicating compression information
             int flag = readBits(buffer, 1);
@@ -419,23 +412,28 @@ void GuitarPro6::readGPX(ByteArray* buffer)
                 int size = readBitsReversed(buffer, bits);
 
                 int pos = (static_cast<int>(bcfsBuffer.size()) - offs);
+                if (pos < 0) {
+                    LOGE() << "invalid back reference in the compressed GPX data";
+                    return;
+                }
                 for (int i = 0; i < (size > offs ? offs : size); i++) {
-                    bcfsBuffer.insert(positionCounter, bcfsBuffer[pos + i]);
-                    positionCounter++;
+                    bcfsBuffer.push_back(bcfsBuffer.constData()[pos + i]);
                 }
             } else {
                 int size = readBitsReversed(buffer, 2);
                 for (int i = 0; i < size; i++) {
-                    bcfsBuffer.insert(positionCounter, readBits(buffer, 8));
-                    positionCounter++;
+                    bcfsBuffer.push_back(static_cast<uint8_t>(readBits(buffer, 8)));
                 }
             }
         }
+        // the compressed data is not needed anymore
+        *buffer = ByteArray();
         // recurse on the decompressed file stored as a byte array
         readGPX(&bcfsBuffer);
     } else if (fileHeader == GPX_HEADER_UNCOMPRESSED) {
-        // this is an uncompressed file - strip the header off
-        *buffer = buffer->right(buffer->size() - sizeof(int));
+        //! NOTE The header is stripped off with a view on the buffer, not with a copy of it
+        ByteArray container = ByteArray::fromRawData(buffer->constData() + sizeof(int), buffer->size() - sizeof(int));
+        buffer = &container;
         size_t sectorSize = 0x1000;
         int offset        = 0;
         while ((offset = (offset + static_cast<int>(sectorSize))) + 3 < static_cast<int>(buffer->size())) {
@@ -445,22 +443,27 @@ void GuitarPro6::readGPX(ByteArray* buffer)
                 int indexFileSize = (offset + 0x8C);
                 int indexOfBlock  = (offset + 0x94);
 
-                // create a byte array and put information about files found in it
+                // collect the sectors of the file found, each of them is copied once
                 int block             = 0;
                 int blockCount        = 0;
-                ByteArray* fileBytes = new ByteArray();
+                size_t fileSize = readInteger(buffer, indexFileSize);
+                ByteArray fileBytes;
+                fileBytes.reserve(std::min(fileSize, buffer->size()));
                 while ((block = (readInteger(buffer, (indexOfBlock + (4 * (blockCount++)))))) != 0) {
-                    fileBytes->push_back(getBytes(buffer, (offset = (block * static_cast<int>(sectorSize))), static_cast<int>(sectorSize)));
+                    offset = block * static_cast<int>(sectorSize);
+                    if (offset < 0 || static_cast<size_t>(offset) >= buffer->size()) {
+                        continue;
+                    }
+                    size_t length = std::min(sectorSize, buffer->size() - offset);
+                    fileBytes.push_back(buffer->constData() + offset, length);
                 }
                 // get file information and read the file
-                size_t fileSize = readInteger(buffer, indexFileSize);
-                if (fileBytes->size() >= fileSize) {
+                if (fileBytes.size() >= fileSize) {
                     ByteArray filenameBytes = readString(buffer, indexFileName, 127);
                     const char* filename = filenameBytes.constChar();
-                    ByteArray data = getBytes(fileBytes, 0, static_cast<int>(fileSize));
-                    parseFile(filename, &data);
+                    fileBytes.truncate(fileSize);
+                    parseFile(filename, &fileBytes);
                 }
-                delete fileBytes;
             }
         }
     }
@@ -519,7 +519,6 @@ class GuitarPro6 : public GuitarPro
     void parseFile(const char* filename, ByteArray* data);
 
     int readBit(ByteArray* buffer);
-    ByteArray getBytes(ByteArray* buffer, int offset, int length);
     void readGPX(ByteArray* buffer);
     int readInteger(ByteArray* buffer, int offset);
     ByteArray readString(ByteArray* buffer, int offset, int length);
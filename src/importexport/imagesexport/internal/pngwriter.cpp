@@ -23,7 +23,10 @@
 #include "pngwriter.h"
 
 #include <cmath>
-#include <QImage>
+#include <deque>
+#include <future>
+
+#include "concurrency/taskscheduler.h"
 
 #include "log.h"
 
@@ -43,6 +46,61 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    QImage image = renderPage(notation, options);
+    image.save(&destinationDevice, "png");
+
+    return true;
+}
+
+//! NOTE Painting goes through engraving and font caches which are not thread safe,
+//! so the pages are painted one after another on this thread. Encoding the images,
+//! which takes most of the time for large images, runs on worker threads meanwhile.
+mu::Ret PngWriter::writePages(INotationPtr notation, const std::vector<PageDevice>& pages, const Options& options)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    TaskScheduler scheduler;
+
+    //! NOTE Limit the number of painted images waiting for encoding, they can be large
+    const size_t maxPendingPages = std::max(static_cast<size_t>(scheduler.threadPoolSize()), size_t(1));
+
+    std::deque<std::future<bool> > pendingPages;
+    bool ok = true;
+
+    auto waitOldestPage = [&pendingPages, &ok]() {
+        ok = pendingPages.front().get() && ok;
+        pendingPages.pop_front();
+    };
+
+    for (const PageDevice& page : pages) {
+        if (pendingPages.size() >= maxPendingPages) {
+            waitOldestPage();
+        }
+
+        Options pageOptions = options;
+        pageOptions[OptionKey::PAGE_NUMBER] = Val(page.page);
+
+        QImage image = renderPage(notation, pageOptions);
+        QIODevice* device = page.device;
+
+        pendingPages.push_back(scheduler.submit([image, device]() {
+            return image.save(device, "png");
+        }));
+    }
+
+    while (!pendingPages.empty()) {
+        waitOldestPage();
+    }
+
+    return ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::UnknownError);
+}
+
+QImage PngWriter::renderPage(INotationPtr notation, const Options& options) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
 
     INotationPainting::Options opt;
@@ -65,11 +123,10 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                                                       Val(configuration()->exportPngWithTransparentBackground())).toBool();
     image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
 
-    mu::draw::Painter painter(&image, "pngwriter");
-
-    notation->painting()->paintPng(&painter, opt);
-
-    image.save(&destinationDevice, "png");
+    {
+        mu::draw::Painter painter(&image, "pngwriter");
+        notation->painting()->paintPng(&painter, opt);
+    }
 
-    return true;
+    return image;
 }
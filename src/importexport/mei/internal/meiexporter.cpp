@@ -23,6 +23,8 @@
 #include "meiexporter.h"
 
 #include <random>
+#include <set>
+#include <sstream>
 
 #include "log.h"
 #include "types/datetime.h"
@@ -79,14 +81,26 @@ using namespace mu::engraving;
 // Use counter-based IDs for layer elements
 #define MEI_COUNTER_BASED_IDS false
 
+// Comment marking where the section content is flushed
+#define MEI_FLUSH_MARK "mscore-flush-mark"
+
+static std::string indentString()
+{
+    // Tabulation of MEI_INDENT * spaces (tabs if 0)
+    return MEI_INDENT ? std::string(MEI_INDENT, ' ') : "\t";
+}
+
 /**
- * Write the Score to the destination file.
+ * Write the Score to the writer.
+ * The measures of the section are written as soon as they are complete, see MeiExporter::flushSection.
  * Return false on error.
  */
 
-bool MeiExporter::write(std::string& meiData)
+bool MeiExporter::write(pugi::xml_writer& writer)
 {
     m_uids = UIDRegister::instance();
+    m_writer = &writer;
+    m_hasFlushed = false;
     m_xmlIDCounter = 0;
 
     m_hasSections = false;
@@ -139,23 +153,93 @@ bool MeiExporter::write(std::string& meiData)
         // Currently not used. To be enabled for unfolding MuseScore Jumps into `@jumpto` MEI attribute if it becomes available on MEI repeatMark
         // this->addJumpToRepeatMarks();
 
-        unsigned int output_flags = pugi::format_default;
-
-        // Tabulation of MEI_INDENT * spaces (tabs if 0)
-        std::string indent = MEI_INDENT ? std::string(MEI_INDENT, ' ') : "\t";
-        std::stringstream strStream;
-        meiDoc.save(strStream, indent.c_str(), output_flags);
-        meiData = strStream.str();
+        if (m_hasFlushed) {
+            this->flushSection(true);
+            // The document text after the flushed section content
+            std::string text = this->documentText();
+            size_t pos = text.find('\n', text.find("<!--" MEI_FLUSH_MARK "-->"));
+            pos = (pos == std::string::npos) ? text.size() : pos + 1;
+            writer.write(text.data() + pos, text.size() - pos);
+        } else {
+            m_flushMark.parent().remove_child(m_flushMark);
+            meiDoc.save(writer, indentString().c_str(), pugi::format_default);
+        }
     }
     catch (char* str) {
         UNUSED(str);
         // Do something with the error message
+        m_writer = nullptr;
         return false;
     }
 
+    m_writer = nullptr;
     return true;
 }
 
+/**
+ * Write the section children that are complete and remove them from the document, keeping the memory bounded by the open spanners.
+ * A child is complete when no open control event in it still needs a @endid, all of them are written when `isLast` is true.
+ * The children are printed at their depth in the document, so the output is the same as when saving the document at once.
+ */
+
+void MeiExporter::flushSection(bool isLast)
+{
+    pugi::xml_node section = m_flushMark.parent();
+    if (!m_writer || !section || (!isLast && m_currentNode != section)) {
+        return;
+    }
+
+    std::set<pugi::xml_node> openChildren;
+    if (!isLast) {
+        for (const auto& controlEvent : m_openControlEventMap) {
+            pugi::xml_node child = controlEvent.second;
+            while (child && child.parent() != section) {
+                child = child.parent();
+            }
+            openChildren.insert(child);
+        }
+    }
+
+    pugi::xml_node child = m_flushMark.next_sibling();
+    if (!child || openChildren.count(child)) {
+        return;
+    }
+
+    if (!m_hasFlushed) {
+        // The document text before the section content, up to the line of the mark
+        std::string text = this->documentText();
+        size_t pos = text.rfind('\n', text.find("<!--" MEI_FLUSH_MARK "-->"));
+        pos = (pos == std::string::npos) ? 0 : pos + 1;
+        m_writer->write(text.data(), pos);
+        m_hasFlushed = true;
+    }
+
+    unsigned int depth = 0;
+    for (pugi::xml_node node = section; node.type() == pugi::node_element; node = node.parent()) {
+        ++depth;
+    }
+
+    std::string indent = indentString();
+    while (child && !openChildren.count(child)) {
+        pugi::xml_node next = child.next_sibling();
+        this->releaseRepeatMarks(child);
+        child.print(*m_writer, indent.c_str(), pugi::format_default, pugi::encoding_utf8, depth);
+        section.remove_child(child);
+        child = next;
+    }
+}
+
+/**
+ * Return the text of the whole document as it currently is.
+ */
+
+std::string MeiExporter::documentText() const
+{
+    std::stringstream strStream;
+    m_mei.root().print(strStream, indentString().c_str(), pugi::format_default);
+    return strStream.str();
+}
+
 //---------------------------------------------------------
 //   convert
 //---------------------------------------------------------
@@ -233,6 +317,8 @@ bool MeiExporter::writeScore()
     m_currentNode = m_currentNode.append_child();
     libmei::Section meiSection;
     meiSection.Write(m_currentNode, this->getSectionXmlId());
+    m_flushMark = m_currentNode.append_child(pugi::node_comment);
+    m_flushMark.set_value(MEI_FLUSH_MARK);
 
     int measureN = 0;
     bool isFirst = true;
@@ -266,6 +352,7 @@ bool MeiExporter::writeScore()
                     this->writeEnding(measure);
                     this->writeMeasure(measure, measureN, isFirst, wasPreviousIrregular);
                     this->writeEndingEnd(measure);
+                    this->flushSection(false);
                     firstSystem = false;
                 }
                 lineBreak = mBase->lineBreak();
@@ -836,6 +923,7 @@ bool MeiExporter::writeMeasure(const Measure* measure, int& measureN, bool& isFi
     m_tstampControlEventMap.clear();
 
     this->addEndidToControlEvents();
+    this->dropUnclosedControlEvents(measure);
 
     // This will prepend the scoreDef
     if (!isFirst) {
@@ -2161,14 +2249,44 @@ void MeiExporter::addJumpToRepeatMarks()
             }
         }
     }
-    // Add the jumpto attribute for all the repeatMarks for which we filled a jumpToXmlId
+    // Add the jumpto attribute for all the repeatMarks for which we filled a jumpToXmlId and that are still in the document
     for (RepeatMark& item : m_repeatMarks) {
-        if (item.m_jumpToXmlId.size() > 0) {
+        if (item.m_node && !item.m_node.attribute("jumpto") && item.m_jumpToXmlId.size() > 0) {
             item.m_node.append_attribute("jumpto") = item.m_jumpToXmlId.c_str();
         }
     }
 }
 
+/**
+ * Resolve the repeat marks written in a section child before it is flushed, since their nodes are removed with it.
+ * The marks are kept without their node, so later jumps can still point to a flushed marker.
+ * A jump to a marker that is not written yet cannot be resolved anymore.
+ */
+
+void MeiExporter::releaseRepeatMarks(pugi::xml_node child)
+{
+    auto isInChild = [child](const RepeatMark& item) {
+        for (pugi::xml_node node = item.m_node; node; node = node.parent()) {
+            if (node == child) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (std::none_of(m_repeatMarks.begin(), m_repeatMarks.end(), isInChild)) {
+        return;
+    }
+
+    this->addJumpToRepeatMarks();
+
+    for (RepeatMark& item : m_repeatMarks) {
+        if (isInChild(item)) {
+            item.m_node = pugi::xml_node();
+        }
+    }
+}
+
 /**
  * Check if the Segment (barLineEnd type) has a Fermata annotation for the given track.
  * Add the Fermata to the m_tstampControlEventMap with the appropriate @staff and @tstamp values.
@@ -2286,6 +2404,42 @@ void MeiExporter::addEndidToControlEvents()
     }
     for (auto item : closedPlists) {
         m_plistMap.erase(item);
+        // Arpeggios are given a @plist only, they are not open anymore
+        m_openControlEventMap.erase(item);
+    }
+}
+
+/**
+ * Close the control events whose end element should have been written with the measure but was not (e.g., in a part not exported).
+ * They are left without @endid or @plist, so they do not prevent the section from being flushed until its end.
+ */
+
+void MeiExporter::dropUnclosedControlEvents(const Measure* measure)
+{
+    std::list<const EngravingItem*> unclosedEvents;
+
+    for (auto controlEvent : m_openControlEventMap) {
+        const EngravingItem* item = controlEvent.first;
+        // For spanning arpeggios, the lower chord is in the same segment
+        const EngravingItem* end = item->isSpanner() ? toSpanner(item)->endElement() : item;
+        if (!end || end->tick() < measure->endTick()) {
+            unclosedEvents.push_back(item);
+        }
+    }
+
+    for (auto item : unclosedEvents) {
+        LOGD() << "Control event without end element: " << item->typeName();
+        m_openControlEventMap.erase(item);
+        m_endingControlEventMap.erase(item);
+        m_plistMap.erase(item);
+    }
+    // Arpeggios still waiting for their lower chord
+    for (auto it = m_arpegPlistMap.begin(); it != m_arpegPlistMap.end();) {
+        if (std::find(unclosedEvents.begin(), unclosedEvents.end(), it->second) != unclosedEvents.end()) {
+            it = m_arpegPlistMap.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
@@ -77,7 +77,7 @@ class MeiExporter
 
 public:
     MeiExporter(engraving::Score* s) { m_score = s; }
-    bool write(std::string& meiData);
+    bool write(pugi::xml_writer& writer);
 
 private:
     bool writeHeader();
@@ -96,6 +96,8 @@ private:
     bool writeMeasure(const engraving::Measure* measure, int& measureN, bool& isFirst, bool& wasLastIrregular);
     bool writeStaff(const engraving::Staff* staff, const engraving::Measure* measure);
     bool writeLayer(engraving::track_idx_t track, const engraving::Staff* staff, const engraving::Measure* measure);
+    void flushSection(bool isLast);
+    std::string documentText() const;
 
     /**
      * Methods for writing MEI elements within a <layer>
@@ -155,12 +157,14 @@ private:
     std::string findStartIdFor(const engraving::EngravingItem* item);
     void addToRepeatMarkList(const engraving::EngravingItem* repeatMark, pugi::xml_node node, const std::string& xmlId);
     void addJumpToRepeatMarks();
+    void releaseRepeatMarks(pugi::xml_node child);
     bool addFermataToMap(engraving::track_idx_t track, const engraving::Segment* segment, const engraving::Measure* measure);
     std::pair<libmei::xsdPositiveInteger_List, double> findTstampFor(const engraving::EngravingItem* item);
     bool isNode(pugi::xml_node node, const String& name);
     pugi::xml_node getLastChordRest(pugi::xml_node node);
     void addNodeToOpenControlEvents(pugi::xml_node node, const engraving::Spanner* spanner, const std::string& startid);
     void addEndidToControlEvents();
+    void dropUnclosedControlEvents(const engraving::Measure* measure);
 
     /**
      * Methods for generating @xml:ids
@@ -196,6 +200,13 @@ private:
     /** Current xml element */
     pugi::xml_node m_currentNode;
 
+    /** The writer the complete section content is flushed to */
+    pugi::xml_writer* m_writer = nullptr;
+    /** The comment marking the position of the flushed content in the section */
+    pugi::xml_node m_flushMark;
+    /** A flag indicating that the document text before the section content has been written */
+    bool m_hasFlushed;
+
     /** When writing layers, keep a pointer to the keySig segment (if any) to prepend a scoreDef if necessary */
     const engraving::Segment* m_keySig;
     /** Same for the timeSig segment */
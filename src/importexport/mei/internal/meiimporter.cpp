@@ -22,6 +22,10 @@
 
 #include "meiimporter.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
 #include "engraving/dom/arpeggio.h"
 #include "engraving/dom/articulation.h"
 #include "engraving/dom/barline.h"
@@ -82,6 +86,124 @@ using namespace mu::engraving;
 
 #define MEI_FB_HARM "fb-harm"
 
+#define MEI_MEASURE_REF "mscore-measure-ref"
+
+static const unsigned int MEI_PARSE_OPTIONS = (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol;
+
+/**
+ * Scan the MEI data for the <measure> elements within <music>, skipping comments, CDATA sections,
+ * processing instructions and attribute values.
+ * Return the data without them, each one being replaced with a reference to its byte range added to `ranges`.
+ * Data in an encoding that is not ASCII compatible is returned unchanged.
+ */
+
+static std::string extractMeasures(const char* data, size_t size, std::vector<std::pair<size_t, size_t> >& ranges)
+{
+    std::string skeleton;
+    size_t copied = 0;
+    size_t pos = 0;
+    int musicDepth = 0;
+    int measureDepth = 0;
+    size_t measureStart = 0;
+
+    auto startsWith = [data, size](size_t p, const char* str) {
+        const size_t len = std::strlen(str);
+        return p + len <= size && std::memcmp(data + p, str, len) == 0;
+    };
+    auto skipTo = [data, size](size_t p, const char* str) {
+        const char* end = std::search(data + p, data + size, str, str + std::strlen(str));
+        return end == data + size ? size : static_cast<size_t>(end - data) + std::strlen(str);
+    };
+    auto addMeasure = [&](size_t start, size_t end) {
+        skeleton.append(data + copied, start - copied);
+        skeleton += "<" MEI_MEASURE_REF " n=\"" + std::to_string(ranges.size()) + "\"/>";
+        ranges.push_back({ start, end - start });
+        copied = end;
+    };
+
+    while (pos < size) {
+        const char* lt = static_cast<const char*>(std::memchr(data + pos, '<', size - pos));
+        if (!lt) {
+            break;
+        }
+        pos = static_cast<size_t>(lt - data);
+
+        if (startsWith(pos, "<!--")) {
+            pos = skipTo(pos + 4, "-->");
+            continue;
+        } else if (startsWith(pos, "<![CDATA[")) {
+            pos = skipTo(pos + 9, "]]>");
+            continue;
+        } else if (startsWith(pos, "<?")) {
+            pos = skipTo(pos + 2, "?>");
+            continue;
+        }
+
+        // find the end of the tag, a doctype can have an internal subset within []
+        const bool isEndTag = startsWith(pos, "</");
+        const size_t nameStart = pos + (isEndTag ? 2 : 1);
+        size_t tagEnd = nameStart;
+        char quote = 0;
+        int bracketDepth = 0;
+        for (; tagEnd < size; ++tagEnd) {
+            const char c = data[tagEnd];
+            if (quote) {
+                if (c == quote) {
+                    quote = 0;
+                }
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '[') {
+                ++bracketDepth;
+            } else if (c == ']') {
+                --bracketDepth;
+            } else if (c == '>' && bracketDepth <= 0) {
+                break;
+            }
+        }
+        if (tagEnd >= size) {
+            // unterminated, left to the parser
+            break;
+        }
+        const bool isEmptyTag = !isEndTag && data[tagEnd - 1] == '/';
+        ++tagEnd;
+
+        auto isName = [&](const char* name) {
+            const size_t nameEnd = nameStart + std::strlen(name);
+            return startsWith(nameStart, name)
+                   && (nameEnd >= size || data[nameEnd] == '>' || data[nameEnd] == '/' || std::isspace(static_cast<unsigned char>(data[nameEnd])));
+        };
+
+        if (isName("music")) {
+            if (isEndTag) {
+                --musicDepth;
+            } else if (!isEmptyTag) {
+                ++musicDepth;
+            }
+        } else if (musicDepth > 0 && isName("measure")) {
+            if (isEndTag) {
+                if (measureDepth > 0 && --measureDepth == 0) {
+                    addMeasure(measureStart, tagEnd);
+                }
+            } else {
+                if (measureDepth == 0) {
+                    measureStart = pos;
+                }
+                if (!isEmptyTag) {
+                    ++measureDepth;
+                } else if (measureDepth == 0) {
+                    addMeasure(measureStart, tagEnd);
+                }
+            }
+        }
+
+        pos = tagEnd;
+    }
+
+    skeleton.append(data + copied, size - copied);
+    return skeleton;
+}
+
 /**
  * Read the Score from the file.
  * Return false on error.
@@ -107,14 +229,27 @@ bool MeiImporter::read(const io::path_t& path)
 
     Convert::logs.clear();
 
+    m_data = ByteArray();
+    m_measureRanges.clear();
+    m_controlEvents.reset();
+
+    if (!fileSystem()->readFile(path, m_data)) {
+        LOGD() << "Cannot open file <" << qPrintable(path.toString()) << ">";
+        return false;
+    }
+
+    // Only the document without the measures is loaded as a whole, each measure is parsed when it is read
+    std::string skeleton = extractMeasures(m_data.constChar(), m_data.size(), m_measureRanges);
+
     pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(
-        path.toStdString().c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+    pugi::xml_parse_result result = doc.load_buffer(skeleton.data(), skeleton.size(), MEI_PARSE_OPTIONS);
+    std::string().swap(skeleton);
 
     if (!result) {
         LOGD() << "Cannot open file <" << qPrintable(path.toString()) << ">";
         return false;
     }
+    m_encoding = result.encoding;
 
     pugi::xml_node root = doc.first_child();
 
@@ -136,6 +271,10 @@ bool MeiImporter::read(const io::path_t& path)
         m_uids->clear();
     }
 
+    m_data = ByteArray();
+    m_measureRanges.clear();
+    m_controlEvents.reset();
+
     return success;
 }
 
@@ -158,6 +297,36 @@ void MeiImporter::addLog(const std::string& msg, pugi::xml_node node)
     Convert::logs.push_back(String("Could not convert the %1 from %2").arg(String::fromStdString(msg), nodeStr));
 }
 
+/**
+ * Parse the measure with the given index in m_measureRanges into `measureDoc`.
+ */
+
+bool MeiImporter::loadMeasure(size_t idx, pugi::xml_document& measureDoc)
+{
+    IF_ASSERT_FAILED(idx < m_measureRanges.size()) {
+        return false;
+    }
+
+    const std::pair<size_t, size_t>& range = m_measureRanges.at(idx);
+    pugi::xml_parse_result result = measureDoc.load_buffer(m_data.constChar() + range.first, range.second, MEI_PARSE_OPTIONS, m_encoding);
+    if (!result) {
+        LOGD() << "Cannot read measure " << idx << ": " << result.description();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Copy a control event node to be kept until the spanners are ended in MeiImporter::addSpannerEnds,
+ * since the document of the measure it belongs to is released once the measure has been read.
+ */
+
+pugi::xml_node MeiImporter::keepControlEvent(pugi::xml_node node)
+{
+    return m_controlEvents.append_copy(node);
+}
+
 /**
  * Return true if the node name matches the name parameter.
  */
@@ -502,7 +671,7 @@ Spanner* MeiImporter::addSpanner(const libmei::Element& meiElement, Measure* mea
     item->setTrack(chordRest->track());
 
     // Add it to the map for setting spanner end in MeiImporter::addSpannerEnds
-    m_openSpannerMap[item] = node;
+    m_openSpannerMap[item] = this->keepControlEvent(node);
 
     return item;
 }
@@ -913,9 +1082,20 @@ bool MeiImporter::readScore(pugi::xml_node root)
 
     bool success = true;
 
+    // The measures are parsed a first time for the ids and the staff and layer numbers needed before reading them
+    std::set<std::pair<int, int> > staffLayerNs;
+
     success = success && this->buildIdMap(scoreNode);
+    this->collectStaffLayerNs(scoreNode, staffLayerNs);
 
-    success = success && this->buildStaffLayerMap(scoreNode);
+    for (size_t idx = 0; success && idx < m_measureRanges.size(); ++idx) {
+        pugi::xml_document measureDoc;
+        success = this->loadMeasure(idx, measureDoc);
+        success = success && this->buildIdMap(measureDoc);
+        this->collectStaffLayerNs(measureDoc, staffLayerNs);
+    }
+
+    success = success && this->buildStaffLayerMap(staffLayerNs);
 
     success = success && this->readScoreDef(scoreDefNode, true);
 
@@ -1229,6 +1409,8 @@ bool MeiImporter::readSectionElements(pugi::xml_node parentNode)
             success = success && this->readEnding(xpathNode.node());
         } else if (elementName == "measure") {
             success = success && this->readMeasure(xpathNode.node());
+        } else if (elementName == MEI_MEASURE_REF) {
+            success = success && this->readMeasureRef(xpathNode.node());
         } else if (elementName == "pb") {
             success = success && this->readPb(xpathNode.node());
         } else if (elementName == "sb") {
@@ -1286,6 +1468,20 @@ bool MeiImporter::readEnding(pugi::xml_node endingNode)
     return success;
 }
 
+/**
+ * Parse the measure referred to and read it.
+ */
+
+bool MeiImporter::readMeasureRef(pugi::xml_node measureRefNode)
+{
+    pugi::xml_document measureDoc;
+    if (!this->loadMeasure(measureRefNode.attribute("n").as_uint(), measureDoc)) {
+        return false;
+    }
+
+    return this->readMeasure(measureDoc.first_child());
+}
+
 /**
  * Read measure and its content.
  * Sets m_endingStart and m_endingEnd pointers as appropriate.
@@ -2165,7 +2361,7 @@ bool MeiImporter::readArpeg(pugi::xml_node arpegNode, Measure* measure)
 
     if (meiArpeg.HasPlist()) {
         // Add the Arpeggio to the open arpeggio map, which will handle ties differently as appropriate
-        m_openArpegMap[arpeggio] = arpegNode;
+        m_openArpegMap[arpeggio] = this->keepControlEvent(arpegNode);
     }
 
     return true;
@@ -2671,7 +2867,7 @@ bool MeiImporter::readTie(pugi::xml_node tieNode, Measure* measure)
     tie->setTrack(startNote->track());
 
     // Still add the Tie to the open Spanner map, which will handle ties differently as appropriate
-    m_openSpannerMap[tie] = tieNode;
+    m_openSpannerMap[tie] = this->keepControlEvent(tieNode);
 
     Convert::tieFromMEI(tie, meiTie, warning);
 
@@ -2828,19 +3024,13 @@ bool MeiImporter::buildIdMap(pugi::xml_node scoreNode)
 }
 
 /**
- * Create a mapping for <staff> `@n` and <layer> `@n`.
- * Usefull only when reading MEI files where the sequence of `@n` is not starting from 1 or not sequential.
- * Not really useful when reading MEI files generated from MuseScore since these will have sequential numbers starting with 1.
+ * Collect the <staff> `@n` values into m_staffNs and the <staff> `@n` and <layer> `@n` pairs into `staffLayerNs`.
+ * A pair with a staff `@n` of 0 marks a layer without staff.
  */
 
-bool MeiImporter::buildStaffLayerMap(pugi::xml_node node)
+void MeiImporter::collectStaffLayerNs(pugi::xml_node node, std::set<std::pair<int, int> >& staffLayerNs)
 {
     pugi::xpath_node_set staves = node.select_nodes("//staff");
-    // Critical error
-    if (staves.empty()) {
-        return false;
-    }
-
     for (pugi::xpath_node staffXpathNode : staves) {
         pugi::xml_node staff = staffXpathNode.node();
         int staffN = staff.attribute("n") ? staff.attribute("n").as_int() : 1;
@@ -2848,21 +3038,38 @@ bool MeiImporter::buildStaffLayerMap(pugi::xml_node node)
     }
 
     pugi::xpath_node_set layers = node.select_nodes("//layer");
-    // Critical error
-    if (layers.empty()) {
-        return false;
-    }
-
     for (pugi::xpath_node layerXpathNode : layers) {
         pugi::xml_node layer = layerXpathNode.node();
         int layerN = layer.attribute("n") ? layer.attribute("n").as_int() : 1;
         pugi::xml_node staff = layer.parent();
         if (!staff) {
+            staffLayerNs.insert({ 0, layerN });
             continue;
         }
         const int staffN = staff.attribute("n") ? staff.attribute("n").as_int() : 1;
-        const int staffIdx = this->getStaffIndex(staffN);
-        m_staffLayerNs[staffIdx].insert(layerN);
+        staffLayerNs.insert({ staffN, layerN });
+    }
+}
+
+/**
+ * Create a mapping for <staff> `@n` and <layer> `@n`, from the values collected with MeiImporter::collectStaffLayerNs.
+ * Usefull only when reading MEI files where the sequence of `@n` is not starting from 1 or not sequential.
+ * Not really useful when reading MEI files generated from MuseScore since these will have sequential numbers starting with 1.
+ */
+
+bool MeiImporter::buildStaffLayerMap(const std::set<std::pair<int, int> >& staffLayerNs)
+{
+    // Critical error
+    if (m_staffNs.empty() || staffLayerNs.empty()) {
+        return false;
+    }
+
+    for (const std::pair<int, int>& staffLayerN : staffLayerNs) {
+        if (staffLayerN.first == 0) {
+            continue;
+        }
+        const int staffIdx = this->getStaffIndex(staffLayerN.first);
+        m_staffLayerNs[staffIdx].insert(staffLayerN.second);
     }
 
     return true;
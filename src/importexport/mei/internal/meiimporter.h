@@ -29,6 +29,7 @@
 #include "imeiconfiguration.h"
 #include "io/ifilesystem.h"
 #include "io/path.h"
+#include "types/bytearray.h"
 
 #include "meiconverter.h"
 
@@ -91,6 +92,7 @@ private:
     bool readStaffGrps(pugi::xml_node parentNode, int& staffSpan, int column, size_t& idx);
     bool readSectionElements(pugi::xml_node parentNode);
     bool readEnding(pugi::xml_node endingNode);
+    bool readMeasureRef(pugi::xml_node measureRefNode);
     bool readMeasure(pugi::xml_node measureNode);
     bool readPb(pugi::xml_node pbNode);
     bool readSb(pugi::xml_node sbNode);
@@ -152,7 +154,8 @@ private:
      * Methods for extracting content from the MEI
      */
     bool buildIdMap(pugi::xml_node scoreNode);
-    bool buildStaffLayerMap(pugi::xml_node root);
+    void collectStaffLayerNs(pugi::xml_node node, std::set<std::pair<int, int> >& staffLayerNs);
+    bool buildStaffLayerMap(const std::set<std::pair<int, int> >& staffLayerNs);
     bool buildTextFrame();
     bool buildScoreParts(pugi::xml_node scoreDefNode);
 
@@ -170,6 +173,8 @@ private:
     int getStaffIndex(int staffN);
     int getVoiceIndex(int staffIdx, int layerN);
     void addLog(const std::string& msg, pugi::xml_node node);
+    bool loadMeasure(size_t idx, pugi::xml_document& measureDoc);
+    pugi::xml_node keepControlEvent(pugi::xml_node node);
     bool isNode(pugi::xml_node node, const String& name);
     engraving::ChordRest* addChordRest(pugi::xml_node node, engraving::Measure* measure, int track, const libmei::Element& meiElement,
                                        int& ticks, bool isRest);
@@ -230,6 +235,13 @@ private:
     std::map<engraving::Spanner*, pugi::xml_node> m_openSpannerMap;
     /* A map for open arpeg that needs to be spanned */
     std::map<engraving::Arpeggio*, pugi::xml_node> m_openArpegMap;
+    /* The copies of the control event nodes in the open maps, which outlive the measure documents */
+    pugi::xml_document m_controlEvents;
+
+    /* The MEI file content and the byte ranges of the measures, parsed one by one */
+    ByteArray m_data;
+    std::vector<std::pair<size_t, size_t> > m_measureRanges;
+    pugi::xml_encoding m_encoding = pugi::encoding_auto;
 
     /** A map of a map for lyrics with extender that needs to be extended */
     std::map<engraving::track_idx_t, std::map<int, std::pair<engraving::Lyrics*, engraving::ChordRest*> > > m_lyricExtenders;
@@ -22,6 +22,8 @@
 
 #include "meiwriter.h"
 
+#include <sstream>
+
 #include "meiexporter.h"
 
 #include "io/file.h"
@@ -34,6 +36,22 @@ using namespace mu;
 using namespace mu::iex::mei;
 using namespace mu::project;
 
+//! NOTE Writes the exported data to the device as it comes, instead of converting the whole file content first
+class DeviceXmlWriter : public pugi::xml_writer
+{
+public:
+    DeviceXmlWriter(QIODevice& device)
+        : m_device(device) {}
+
+    void write(const void* data, size_t size) override
+    {
+        m_device.write(static_cast<const char*>(data), static_cast<qint64>(size));
+    }
+
+private:
+    QIODevice& m_device;
+};
+
 std::vector<INotationWriter::UnitType> MeiWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART };
@@ -57,12 +75,8 @@ mu::Ret MeiWriter::write(notation::INotationPtr notation, QIODevice& destination
     }
 
     MeiExporter exporter(score);
-    std::string meiData;
-    if (exporter.write(meiData)) {
-        // Still using QTextStream since we have a QIODevice
-        QTextStream out(&destinationDevice);
-        out << String::fromStdString(meiData);
-        out.flush();
+    DeviceXmlWriter writer(destinationDevice);
+    if (exporter.write(writer)) {
         return make_ok();
     } else {
         return make_ret(Ret::Code::UnknownError);
@@ -74,8 +88,13 @@ mu::engraving::Err MeiWriter::writeScore(mu::engraving::Score* score, const io::
     MeiExporter exporter(score);
     // Force no layout option in this case
     exporter.configuration()->setMeiExportLayout(false);
-    std::string meiData;
-    if (exporter.write(meiData) && io::File::writeFile(path, ByteArray(meiData.c_str(), meiData.size()))) {
+    std::stringstream strStream;
+    pugi::xml_writer_stream writer(strStream);
+    if (!exporter.write(writer)) {
+        return engraving::Err::UnknownError;
+    }
+    const std::string meiData = strStream.str();
+    if (io::File::writeFile(path, ByteArray::fromRawData(meiData.c_str(), meiData.size()))) {
         return engraving::Err::NoError;
     } else {
         return engraving::Err::UnknownError;
@@ -303,8 +303,8 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                 }
 
                 for (size_t e = 0; e < events.size(); ++e) {
-                    auto& multimap = events[e];
-                    for (auto& item : multimap) {
+                    auto& channelEvents = events[e];
+                    for (auto& item : channelEvents) {
                         const NPlayEvent& event = item.second;
                         if (event.isMuted()) {
                             continue;
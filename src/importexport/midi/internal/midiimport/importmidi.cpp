@@ -20,11 +20,13 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <future>
 #include <set>
 
 #include <QFile>
 
 #include "translation.h"
+#include "concurrency/taskscheduler.h"
 
 #include "engraving/engravingerrors.h"
 #include "engraving/rw/xmlwriter.h"
@@ -193,7 +195,7 @@ void setChordVoice(MidiChord& chord, int voice)
 
 void findAllTupletsForDrums(
     MTrack& mtrack,
-    TimeSigMap* sigmap,
+    const TimeSigMap* sigmap,
     const ReducedFraction& basicQuant)
 {
     const size_t drumVoiceCount = 2;
@@ -232,57 +234,87 @@ void findAllTupletsForDrums(
     // note: temporary local tuplets and chords are deleted here
 }
 
+void quantizeTrack(MTrack& mtrack,
+                   const TimeSigMap* sigmap,
+                   const ReducedFraction& lastTick)
+{
+    auto& opers = midiImportOperations;
+    // pass current track index through MidiImportOperations
+    // for further usage
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+
+    const auto basicQuant = Quantize::quantValueToFraction(
+        opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
+               "quantizeTrack", "Last tick is less than max note off time");
+#endif
+    MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+
+    if (mtrack.mtrack->drumTrack()) {
+        findAllTupletsForDrums(mtrack, sigmap, basicQuant);
+    } else {
+        MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    }
+#ifdef QT_DEBUG
+    Q_ASSERT_X(!doNotesOverlap(mtrack),
+               "quantizeTrack",
+               "There are overlapping notes of the same voice that is incorrect");
+#endif
+    // (4/3 of the smallest duration) tol is less sensitive
+    // to on time inaccuracies than 1/2 earlier
+    MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
+    Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
+    MidiTuplet::removeEmptyTuplets(mtrack);
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
+               "quantizeTrack", "Tuplet chord/note is outside tuplet "
+                                "or non-tuplet chord/note is inside tuplet");
+#endif
+}
+
 void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
-                       TimeSigMap* sigmap,
+                       const TimeSigMap* sigmap,
                        const ReducedFraction& lastTick)
 {
     auto& opers = midiImportOperations;
 
+    std::vector<MTrack*> tracksToQuantize;
     for (auto& track: tracks) {
         MTrack& mtrack = track.second;
         if (mtrack.chords.empty()) {
             continue;
         }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
-
         if (opers.data()->processingsOfOpenedFile == 0) {
             opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
             if (mtrack.mtrack->drumTrack()) {
                 opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
             }
         }
-        const auto basicQuant = Quantize::quantValueToFraction(
-            opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
-                   "quantizeAllTracks", "Last tick is less than max note off time");
-#endif
-        MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+        tracksToQuantize.push_back(&mtrack);
+    }
 
-        if (mtrack.mtrack->drumTrack()) {
-            findAllTupletsForDrums(mtrack, sigmap, basicQuant);
-        } else {
-            MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    if (tracksToQuantize.size() < 2) {
+        for (MTrack* mtrack: tracksToQuantize) {
+            quantizeTrack(*mtrack, sigmap, lastTick);
         }
-#ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
-                   "quantizeAllTracks",
-                   "There are overlapping notes of the same voice that is incorrect");
-#endif
-        // (4/3 of the smallest duration) tol is less sensitive
-        // to on time inaccuracies than 1/2 earlier
-        MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
-        Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
-        MidiTuplet::removeEmptyTuplets(mtrack);
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
-                   "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
-                                        "or non-tuplet chord/note is inside tuplet");
-#endif
+        return;
+    }
+
+    // tracks are independent here and the import operations are only read,
+    // so the tuplet search and quantization of each track runs on its own thread;
+    // the result is the same as with the serial processing
+    TaskScheduler scheduler;
+    std::vector<std::future<void> > quantizedTracks;
+    for (MTrack* mtrack: tracksToQuantize) {
+        quantizedTracks.push_back(scheduler.submit([mtrack, sigmap, &lastTick]() {
+            quantizeTrack(*mtrack, sigmap, lastTick);
+        }));
+    }
+    for (auto& quantizedTrack: quantizedTracks) {
+        quantizedTrack.get();
     }
 }
 
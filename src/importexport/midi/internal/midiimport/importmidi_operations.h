@@ -259,7 +259,8 @@ private:
 
     QString _currentMidiFile;
     QString _midiOperationsFile;
-    int _currentTrack = -1;
+    // thread local because the tracks are quantized in parallel
+    inline static thread_local int _currentTrack = -1;
 
     std::map<QString, FileData> _data;      // <file name, tracks data>
 };
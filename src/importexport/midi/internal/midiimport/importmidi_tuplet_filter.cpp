@@ -27,10 +27,24 @@
 #include "importmidi_inner.h"
 #include "engraving/dom/mscore.h"
 
+#include <atomic>
+#include <numeric>
 #include <set>
 
 namespace mu::iex::midi {
 namespace MidiTuplet {
+// limit of the tried tuplet combinations in a bar, so pathological bars cannot stall the import;
+// the search is deterministic, so the result does not depend on the machine speed
+static constexpr size_t MAX_SEARCH_STEPS = 100000;
+
+// tracks are quantized in parallel
+static std::atomic<size_t> exhaustedSearches { 0 };
+
+size_t exhaustedSearchCount()
+{
+    return exhaustedSearches;
+}
+
 bool isMoreTupletVoicesAllowed(int voicesInUse, int availableVoices)
 {
     return !(voicesInUse >= availableVoices || voicesInUse >= tupletVoiceLimit());
@@ -582,9 +596,16 @@ void findNextTuplet(
     const std::vector<TupletInfo>& tuplets,
     const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
     size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    size_t& searchStepsLeft)
 {
     while (!validTuplets.empty()) {
+        // search budget is exhausted - keep the best tuplets found so far
+        if (searchStepsLeft == 0) {
+            return;
+        }
+        --searchStepsLeft;
+
         size_t index = validTuplets.first();
 
         bool isCommonGroupBegins = (selectedTuplets.empty() && index == commonsSize);
@@ -662,7 +683,8 @@ void findNextTuplet(
             }
         } else {
             findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant,
+                           searchStepsLeft);
         }
 
         selectedTuplets.pop_back();
@@ -692,7 +714,8 @@ std::vector<int> findBestTuplets(
     const std::vector<TupletCommon>& tupletCommons,
     const std::vector<TupletInfo>& tuplets,
     size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    size_t maxSearchSteps)
 {
     std::vector<int> bestTupletIndexes;
     std::vector<int> selectedTuplets;
@@ -700,9 +723,15 @@ std::vector<int> findBestTuplets(
     const auto tupletIntervals = findTupletIntervals(tuplets, basicQuant);
 
     ValidTuplets validTuplets(int(tuplets.size()));
+    size_t searchStepsLeft = maxSearchSteps;
 
     findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant,
+                   searchStepsLeft);
+
+    if (searchStepsLeft == 0) {
+        ++exhaustedSearches;
+    }
 
     return bestTupletIndexes;
 }
@@ -746,6 +775,13 @@ void removeExtraTuplets(std::vector<TupletInfo>& tuplets)
 
 void filterTuplets(std::vector<TupletInfo>& tuplets,
                    const ReducedFraction& basicQuant)
+{
+    filterTuplets(tuplets, basicQuant, MAX_SEARCH_STEPS);
+}
+
+void filterTuplets(std::vector<TupletInfo>& tuplets,
+                   const ReducedFraction& basicQuant,
+                   size_t maxSearchSteps)
 {
     if (tuplets.empty()) {
         return;
@@ -763,15 +799,22 @@ void filterTuplets(std::vector<TupletInfo>& tuplets,
                "MIDI tuplets: filterTuplets",
                "Uncommon tuplets have common chords but they shouldn't");
 #endif
+    std::vector<int> uncommonIndexes(uncommons.begin(), uncommons.end());
     size_t commonsSize = tuplets.size();
     if (uncommons.size() > 1) {
         commonsSize -= uncommons.size();
         moveUncommonTupletsToEnd(tuplets, uncommons);
+        std::iota(uncommonIndexes.begin(), uncommonIndexes.end(), int(commonsSize));
     }
     const auto tupletCommons = findTupletCommons(tuplets);
 
-    const std::vector<int> bestIndexes = findBestTuplets(tupletCommons, tuplets,
-                                                         commonsSize, basicQuant);
+    std::vector<int> bestIndexes = findBestTuplets(tupletCommons, tuplets,
+                                                   commonsSize, basicQuant, maxSearchSteps);
+    // the search budget can run out before any combination is complete;
+    // tuplets of the uncommon group have no common chords, so they can be used together
+    if (bestIndexes.empty()) {
+        bestIndexes = uncommonIndexes;
+    }
 #ifdef QT_DEBUG
     Q_ASSERT_X(validateSelectedTuplets(bestIndexes.begin(), bestIndexes.end(), tuplets),
                "MIDI tuplets: filterTuplets", "Tuplets have common chords but they shouldn't");
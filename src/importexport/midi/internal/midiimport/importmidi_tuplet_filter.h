@@ -22,6 +22,7 @@
 #ifndef IMPORTMIDI_TUPLET_FILTER_H
 #define IMPORTMIDI_TUPLET_FILTER_H
 
+#include <cstddef>
 #include <vector>
 
 namespace mu::iex::midi {
@@ -31,6 +32,11 @@ namespace MidiTuplet {
 struct TupletInfo;
 
 void filterTuplets(std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant);
+// the same with the given limit of the tried tuplet combinations
+void filterTuplets(std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant, size_t maxSearchSteps);
+
+// number of the tuplet searches that used up their limit of steps
+size_t exhaustedSearchCount();
 } // namespace MidiTuplet
 } // namespace mu::iex::midi
 
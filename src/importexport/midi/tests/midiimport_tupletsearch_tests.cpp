@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+
+#include <iterator>
+#include <set>
+
+#include <QDir>
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/engravingerrors.h"
+#include "engraving/types/constants.h"
+
+#include "importexport/midi/internal/midiimport/importmidi_chord.h"
+#include "importexport/midi/internal/midiimport/importmidi_fraction.h"
+#include "importexport/midi/internal/midiimport/importmidi_inner.h"
+#include "importexport/midi/internal/midiimport/importmidi_tuplet_filter.h"
+
+namespace mu::iex::midi {
+extern engraving::Err importMidi(engraving::MasterScore*, const QString& name);
+}
+
+using namespace mu::engraving;
+using namespace mu::iex::midi;
+
+static const QString MIDIIMPORT_DIR("midiimport_data/");
+
+//---------------------------------------------------------
+//   TestImportMidiTupletSearch
+//---------------------------------------------------------
+
+class TestImportMidiTupletSearch : public QObject
+{
+    Q_OBJECT
+
+    // 12 chords of one note on the triplet 8ths of a 4/4 bar
+    std::multimap<ReducedFraction, MidiChord> tripletChords() const
+    {
+        std::multimap<ReducedFraction, MidiChord> chords;
+        for (int i = 0; i != 12; ++i) {
+            MidiChord chord;
+            MidiNote note;
+            note.pitch = 60;
+            note.velo = 80;
+            note.offTime = ReducedFraction(i + 1, 12);
+            chord.notes.push_back(note);
+            chords.insert({ ReducedFraction(i, 12), chord });
+        }
+        return chords;
+    }
+
+    // triplet of every chordStep-th chord from the given one, it is chordStep quarters long
+    MidiTuplet::TupletInfo triplet(std::multimap<ReducedFraction, MidiChord>& chords, int firstChord, int chordStep) const
+    {
+        MidiTuplet::TupletInfo tuplet;
+        tuplet.onTime = ReducedFraction(firstChord, 12);
+        tuplet.len = ReducedFraction(chordStep, 4);
+        tuplet.tupletNumber = 3;
+        tuplet.firstChordIndex = 0;
+        tuplet.tupletSumError = ReducedFraction(0, 1);
+        tuplet.regularSumError = ReducedFraction(0, 1);
+        tuplet.sumLengthOfRests = ReducedFraction(0, 1);
+
+        auto it = chords.begin();
+        std::advance(it, firstChord);
+        for (int i = 0; i != 3; ++i) {
+            tuplet.chords.insert({ it->first, it });
+            if (i != 2) {
+                std::advance(it, chordStep);
+            }
+        }
+        return tuplet;
+    }
+
+    // quarter, half and whole note triplets, all of them overlap
+    std::vector<MidiTuplet::TupletInfo> overlappingTriplets(std::multimap<ReducedFraction, MidiChord>& chords) const
+    {
+        std::vector<MidiTuplet::TupletInfo> tuplets;
+        for (int i = 0; i != 4; ++i) {
+            tuplets.push_back(triplet(chords, i * 3, 1));
+        }
+        for (int i = 0; i != 2; ++i) {
+            tuplets.push_back(triplet(chords, i * 6, 2));
+        }
+        tuplets.push_back(triplet(chords, 0, 4));
+
+        for (size_t i = 0; i != tuplets.size(); ++i) {
+            tuplets[i].id = int(i);
+        }
+        return tuplets;
+    }
+
+    // no chord is in two of the tuplets
+    bool haveNoCommonChords(const std::vector<MidiTuplet::TupletInfo>& tuplets) const
+    {
+        std::set<const std::pair<const ReducedFraction, MidiChord>*> usedChords;
+        for (const auto& tuplet: tuplets) {
+            for (const auto& chord: tuplet.chords) {
+                if (!usedChords.insert(&*chord.second).second) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private slots:
+    void tupletFilesBelowSearchLimit();
+    void limitedSearchResult();
+};
+
+//---------------------------------------------------------
+//   tupletFilesBelowSearchLimit
+//   the searches for the tuplet test files finish within the limit,
+//   so they import as without the limit
+//---------------------------------------------------------
+
+void TestImportMidiTupletSearch::tupletFilesBelowSearchLimit()
+{
+    const QStringList files = QDir(QString(iex_midi_tests_DATA_ROOT) + "/" + MIDIIMPORT_DIR)
+                              .entryList({ "*tuplet*.mid" }, QDir::Files, QDir::Name);
+    QVERIFY(!files.isEmpty());
+
+    for (const QString& file : files) {
+        const size_t exhaustedSearches = MidiTuplet::exhaustedSearchCount();
+
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        QCOMPARE(importMidi(score, QString(iex_midi_tests_DATA_ROOT) + "/" + MIDIIMPORT_DIR + file), Err::NoError);
+        delete score;
+
+        if (MidiTuplet::exhaustedSearchCount() != exhaustedSearches) {
+            QFAIL(qPrintable(file + ": the tuplet search used up its limit"));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   limitedSearchResult
+//   a search stopped by the limit keeps tuplets without common chords
+//---------------------------------------------------------
+
+void TestImportMidiTupletSearch::limitedSearchResult()
+{
+    const ReducedFraction basicQuant = ReducedFraction::fromTicks(Constants::DIVISION) / 4;    // 1/16
+
+    auto chords = tripletChords();
+    std::vector<MidiTuplet::TupletInfo> unlimited = overlappingTriplets(chords);
+    MidiTuplet::filterTuplets(unlimited, basicQuant);
+    QVERIFY(!unlimited.empty());
+    QVERIFY(haveNoCommonChords(unlimited));
+
+    for (size_t maxSearchSteps : { 1, 2, 3 }) {
+        const size_t exhaustedSearches = MidiTuplet::exhaustedSearchCount();
+
+        std::vector<MidiTuplet::TupletInfo> limited = overlappingTriplets(chords);
+        MidiTuplet::filterTuplets(limited, basicQuant, maxSearchSteps);
+
+        QVERIFY(MidiTuplet::exhaustedSearchCount() > exhaustedSearches);
+        QVERIFY(!limited.empty());
+        QVERIFY(haveNoCommonChords(limited));
+    }
+
+    // the limit is not reached
+    std::vector<MidiTuplet::TupletInfo> large = overlappingTriplets(chords);
+    MidiTuplet::filterTuplets(large, basicQuant, 1000);
+    QCOMPARE(large.size(), unlimited.size());
+    for (size_t i = 0; i != large.size(); ++i) {
+        QCOMPARE(large[i].id, unlimited[i].id);
+    }
+}
+
+QTEST_MAIN(TestImportMidiTupletSearch)
+
+#include "midiimport_tupletsearch_tests.moc"
@@ -278,9 +278,11 @@ class SlurHandler
 
 public:
     SlurHandler();
+    void collectSlurs(const Score* score);
     void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
 
 private:
+    QHash<const EngravingItem*, QVector<const Slur*> > _slurs;     // slurs starting or stopping at a chord or rest
     void doSlurStart(const Slur* s, Notations& notations, XmlWriter& xml);
     void doSlurStop(const Slur* s, Notations& notations, XmlWriter& xml);
 };
@@ -372,6 +374,7 @@ class ExportMusicXml
     TrillHash _trillStart;
     TrillHash _trillStop;
     MxmlInstrumentMap instrMap;
+    std::map<Fraction, std::vector<Spanner*> > _spannerStops;     // writable spanners, mapped on tick2
 
     int findBracket(const TextLineBase* tl) const;
     int findDashes(const TextLineBase* tl) const;
@@ -408,6 +411,7 @@ class ExportMusicXml
     void repeatAtMeasureStart(Attributes& attr, const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
     void repeatAtMeasureStop(const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
     void writeParts();
+    void collectSpannerStops();
 
     static QString fermataPosition(const Fermata* const fermata);
     static QString elementPosition(const ExportMusicXml* const expMxml, const EngravingItem* const elm);
@@ -444,6 +448,7 @@ public:
     double getTenthsFromDots(double) const;
     Fraction tick() const { return _tick; }
     void writeInstrumentDetails(const Instrument* instrument);
+    const std::vector<Spanner*>& spannersStoppingAt(const Fraction& tick2) const;
 
     static bool canWrite(const EngravingItem* e);
 };
@@ -812,34 +817,59 @@ static const ChordRest* findFirstChordRest(const Slur* s)
     }
 }
 
+//---------------------------------------------------------
+//   collectSlurs
+//---------------------------------------------------------
+
+/**
+ Map the chords and rests in \a score on the slurs starting or stopping there,
+ in score order, so that doSlurs() does not have to search all spanners.
+ */
+
+void SlurHandler::collectSlurs(const Score* score)
+{
+    _slurs.clear();
+    for (const auto& it : score->spanner()) {
+        auto sp = it.second;
+        if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
+            continue;
+        }
+        const auto s = static_cast<const Slur*>(sp);
+        if (sp->startElement()) {
+            _slurs[sp->startElement()].push_back(s);
+        }
+        if (sp->endElement() && sp->endElement() != sp->startElement()) {
+            _slurs[sp->endElement()].push_back(s);
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   doSlurs
 //---------------------------------------------------------
 
 void SlurHandler::doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml)
 {
-    // loop over all slurs twice, first to handle the stops, then the starts
+    // slur(s) starting or stopping at this chord
+    const auto it = _slurs.constFind(chordRest);
+    if (it == _slurs.constEnd()) {
+        return;
+    }
+
+    // loop over the slurs twice, first to handle the stops, then the starts
     for (int i = 0; i < 2; ++i) {
-        // search for slur(s) starting or stopping at this chord
-        for (const auto& it : chordRest->score()->spanner()) {
-            auto sp = it.second;
-            if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
-                continue;
-            }
-            if (chordRest == sp->startElement() || chordRest == sp->endElement()) {
-                const auto s = static_cast<const Slur*>(sp);
-                const auto firstChordRest = findFirstChordRest(s);
-                if (firstChordRest) {
-                    if (i == 0) {
-                        // first time: do slur stops
-                        if (firstChordRest != chordRest) {
-                            doSlurStop(s, notations, xml);
-                        }
-                    } else {
-                        // second time: do slur starts
-                        if (firstChordRest == chordRest) {
-                            doSlurStart(s, notations, xml);
-                        }
+        for (const auto s : it.value()) {
+            const auto firstChordRest = findFirstChordRest(s);
+            if (firstChordRest) {
+                if (i == 0) {
+                    // first time: do slur stops
+                    if (firstChordRest != chordRest) {
+                        doSlurStop(s, notations, xml);
+                    }
+                } else {
+                    // second time: do slur starts
+                    if (firstChordRest == chordRest) {
+                        doSlurStart(s, notations, xml);
                     }
                 }
             }
@@ -6383,21 +6413,15 @@ static void spannerStart(ExportMusicXml* exp, track_idx_t strack, track_idx_t et
 //---------------------------------------------------------
 
 // called after writing each chord or rest to check if a spanner must be stopped
-// loop over all spanners and find spanners in strack ending at tick2
+// loop over the spanners ending at tick2 and find spanners in strack
 // note that more than one voice may contains notes ending at tick2,
 // remember which spanners have already been stopped (the "stopped" set)
 
 static void spannerStop(ExportMusicXml* exp, track_idx_t strack, track_idx_t etrack, const Fraction& tick2, staff_idx_t sstaff,
                         QSet<const Spanner*>& stopped)
 {
-    for (auto it : exp->score()->spanner()) {
-        Spanner* e = it.second;
-
-        if (!exp->canWrite(e)) {
-            continue;
-        }
-
-        if (e->tick2() != tick2 || e->track() < strack || e->track() >= etrack) {
+    for (Spanner* e : exp->spannersStoppingAt(tick2)) {
+        if (e->track() < strack || e->track() >= etrack) {
             continue;
         }
 
@@ -7882,6 +7906,37 @@ void ExportMusicXml::writeParts()
     }
 }
 
+//---------------------------------------------------------
+//  collectSpannerStops
+//---------------------------------------------------------
+
+/**
+ Map the writable spanners on their end tick, in score order,
+ as spannerStop() is called for each chord and rest.
+ */
+
+void ExportMusicXml::collectSpannerStops()
+{
+    _spannerStops.clear();
+    for (const auto& it : _score->spanner()) {
+        Spanner* e = it.second;
+        if (canWrite(e)) {
+            _spannerStops[e->tick2()].push_back(e);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//  spannersStoppingAt
+//---------------------------------------------------------
+
+const std::vector<Spanner*>& ExportMusicXml::spannersStoppingAt(const Fraction& tick2) const
+{
+    static const std::vector<Spanner*> noSpanners;
+    const auto it = _spannerStops.find(tick2);
+    return it != _spannerStops.end() ? it->second : noSpanners;
+}
+
 //---------------------------------------------------------
 //  findJumpElements
 //---------------------------------------------------------
@@ -7933,6 +7988,8 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
     }
 
     _jumpElements = findJumpElements(_score);
+    sh.collectSlurs(_score);
+    collectSpannerStops();
 
     _xml.setDevice(dev);
     _xml.startDocument();
@@ -28,6 +28,7 @@
 #include "importmxmllogger.h"
 #include "importmxmlpass1.h"
 #include "importmxmlpass2.h"
+#include "importmxmlreader.h"
 
 #include "engraving/dom/part.h"
 #include "engraving/dom/score.h"
@@ -95,17 +96,20 @@ Err importMusicXMLfromBuffer(Score* score, const QString& /*name*/, QIODevice* d
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_TRACE); // also include tracing
 
-    // pass 1
+    //! NOTE The document is tokenized once, both passes read the same events
     dev->seek(0);
+    MxmlEventStream stream;
+    stream.read(dev);
+
+    // pass 1
     MusicXMLParserPass1 pass1(score, &logger);
-    Err res = pass1.parse(dev);
+    Err res = pass1.parse(stream);
     const auto pass1_errors = pass1.errors();
 
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
     if (res == Err::NoError) {
-        dev->seek(0);
-        res = pass2.parse(dev);
+        res = pass2.parse(stream);
     }
 
     for (const Part* part : score->parts()) {
@@ -43,7 +43,7 @@ namespace mu::engraving {
 
 // TODO: split in reading parameters versus creation
 
-static Accidental* accidental(QXmlStreamReader& e, Score* score)
+static Accidental* accidental(MxmlStreamReader& e, Score* score)
 {
     const bool cautionary = e.attributes().value("cautionary") == "yes";
     const bool editorial = e.attributes().value("editorial") == "yes";
@@ -82,7 +82,7 @@ static Accidental* accidental(QXmlStreamReader& e, Score* score)
  Handle <display-step> and <display-octave> for <rest> and <unpitched>
  */
 
-void mxmlNotePitch::displayStepOctave(QXmlStreamReader& e)
+void mxmlNotePitch::displayStepOctave(MxmlStreamReader& e)
 {
     while (e.readNextStartElement()) {
         if (e.name() == "display-step") {
@@ -117,7 +117,7 @@ void mxmlNotePitch::displayStepOctave(QXmlStreamReader& e)
  Parse the /score-partwise/part/measure/note/pitch node.
  */
 
-void mxmlNotePitch::pitch(QXmlStreamReader& e)
+void mxmlNotePitch::pitch(MxmlStreamReader& e)
 {
     // defaults
     _step = -1;
@@ -171,7 +171,7 @@ void mxmlNotePitch::pitch(QXmlStreamReader& e)
  Return true if handled.
  */
 
-bool mxmlNotePitch::readProperties(QXmlStreamReader& e, Score* score)
+bool mxmlNotePitch::readProperties(MxmlStreamReader& e, Score* score)
 {
     const QStringRef& tag(e.name());
 
@@ -965,14 +965,14 @@ static void fixupSigmap(MxmlLogger* logger, Score* score, const QVector<Fraction
 //---------------------------------------------------------
 
 /**
- Parse MusicXML in \a device and extract pass 1 data.
+ Parse the MusicXML events in \a stream and extract pass 1 data.
  */
 
-Err MusicXMLParserPass1::parse(QIODevice* device)
+Err MusicXMLParserPass1::parse(const MxmlEventStream& stream)
 {
-    _logger->logDebugTrace("MusicXMLParserPass1::parse device");
+    _logger->logDebugTrace("MusicXMLParserPass1::parse stream");
     _parts.clear();
-    _e.setDevice(device);
+    _e.setEventStream(&stream);
     auto res = parse();
     if (res != Err::NoError) {
         return res;
@@ -1320,7 +1320,7 @@ static QString decodeEntities(const QString& src)
  Read the next part of a MusicXML formatted string and convert to MuseScore internal encoding.
  */
 
-static QString nextPartOfFormattedString(QXmlStreamReader& e)
+static QString nextPartOfFormattedString(MxmlStreamReader& e)
 {
     //QString lang       = e.attribute(QString("xml:lang"), "it");
     QString fontWeight = e.attributes().value("font-weight").toString();
@@ -2593,7 +2593,7 @@ void MusicXMLParserPass1::clef(const QString& /* partId */)
 
 // TODO: share between pass 1 and pass 2
 
-static bool determineTimeSig(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static bool determineTimeSig(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                              const QString beats, const QString beatType, const QString timeSymbol,
                              TimeSigType& st, int& bts, int& btp)
 {
@@ -3463,7 +3463,7 @@ void MusicXMLParserPass1::notePrintSpacingNo(Fraction& dura)
 //   calcTicks
 //---------------------------------------------------------
 
-Fraction MusicXMLParserPass1::calcTicks(const int& intTicks, const int& _divisions, const QXmlStreamReader* const xmlReader)
+Fraction MusicXMLParserPass1::calcTicks(const int& intTicks, const int& _divisions, const MxmlStreamReader* const xmlReader)
 {
     Fraction dura(0, 1);              // invalid unless set correctly
 
@@ -3509,7 +3509,7 @@ Fraction MusicXMLParserPass1::calcTicks(const int& intTicks, const int& _divisio
  Parse the /score-partwise/part/measure/note/duration node.
  */
 
-void MusicXMLParserPass1::duration(Fraction& dura, QXmlStreamReader& e)
+void MusicXMLParserPass1::duration(Fraction& dura, MxmlStreamReader& e)
 {
     Q_ASSERT(e.isStartElement() && e.name() == "duration");
     _logger->logDebugTrace("MusicXMLParserPass1::duration", &e);
@@ -23,7 +23,7 @@
 #ifndef __IMPORTMXMLPASS1_H__
 #define __IMPORTMXMLPASS1_H__
 
-#include <QXmlStreamReader>
+#include "importmxmlreader.h"
 
 #include "importxmlfirstpass.h"
 #include "musicxml.h" // for the creditwords and MusicXmlPartGroupList definitions
@@ -122,7 +122,7 @@ class MusicXMLParserPass1
 public:
     MusicXMLParserPass1(Score* score, MxmlLogger* logger);
     void initPartState(const QString& partId);
-    Err parse(QIODevice* device);
+    Err parse(const MxmlEventStream& stream);
     Err parse();
     QString errors() const { return _errors; }
     void scorePartwise();
@@ -151,9 +151,9 @@ public:
     void note(const QString& partId, const Fraction cTime, Fraction& missingPrev, Fraction& dura, Fraction& missingCurr,
               VoiceOverlapDetector& vod, MxmlTupletStates& tupletStates);
     void notePrintSpacingNo(Fraction& dura);
-    Fraction calcTicks(const int& intTicks, const int& _divisions, const QXmlStreamReader* const xmlReader);
+    Fraction calcTicks(const int& intTicks, const int& _divisions, const MxmlStreamReader* const xmlReader);
     Fraction calcTicks(const int& intTicks) { return calcTicks(intTicks, _divs, &_e); }
-    void duration(Fraction& dura, QXmlStreamReader& e);
+    void duration(Fraction& dura, MxmlStreamReader& e);
     void duration(Fraction& dura) { duration(dura, _e); }
     void forward(Fraction& dura);
     void backup(Fraction& dura);
@@ -189,7 +189,7 @@ private:
     void addError(const QString& error);        ///< Add an error to be shown in the GUI
 
     // generic pass 1 data
-    QXmlStreamReader _e;
+    MxmlStreamReader _e;
     int _divs;                                  ///< Current MusicXML divisions value
     QMap<QString, MusicXmlPart> _parts;         ///< Parts data, mapped on part id
     std::set<int> _systemStartMeasureNrs;       ///< Measure numbers of measures starting a page
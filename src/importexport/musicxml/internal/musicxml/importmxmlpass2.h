@@ -131,14 +131,14 @@ private:
 class MusicXMLParserLyric
 {
 public:
-    MusicXMLParserLyric(const LyricNumberHandler lyricNumberHandler, QXmlStreamReader& e, Score* score, MxmlLogger* logger);
+    MusicXMLParserLyric(const LyricNumberHandler lyricNumberHandler, MxmlStreamReader& e, Score* score, MxmlLogger* logger);
     QSet<Lyrics*> extendedLyrics() const { return _extendedLyrics; }
     QMap<int, Lyrics*> numberedLyrics() const { return _numberedLyrics; }
     void parse();
 private:
     void skipLogCurrElem();
     const LyricNumberHandler _lyricNumberHandler;
-    QXmlStreamReader& _e;
+    MxmlStreamReader& _e;
     Score* const _score;                        // the score
     MxmlLogger* _logger;                        ///< Error logger
     QMap<int, Lyrics*> _numberedLyrics;   // lyrics with valid number
@@ -207,7 +207,7 @@ using SpannerSet = std::set<Spanner*>;
 class MusicXMLParserNotations
 {
 public:
-    MusicXMLParserNotations(QXmlStreamReader& e, Score* score, MxmlLogger* logger);
+    MusicXMLParserNotations(MxmlStreamReader& e, Score* score, MxmlLogger* logger);
     void parse();
     void addToScore(ChordRest* const cr, Note* const note, const int tick, SlurStack& slurs, Glissando* glissandi[MAX_NUMBER_LEVEL][2],
                     MusicXmlSpannerMap& spanners, TrillStack& trills, Tie*& tie);
@@ -232,7 +232,7 @@ private:
     void technical();
     void tied();
     void tuplet();
-    QXmlStreamReader& _e;
+    MxmlStreamReader& _e;
     Score* const _score;                        // the score
     MxmlLogger* _logger;                              // the error logger
     QString _errors;                    // errors to present to the user
@@ -259,7 +259,7 @@ class MusicXMLParserPass2
 {
 public:
     MusicXMLParserPass2(Score* score, MusicXMLParserPass1& pass1, MxmlLogger* logger);
-    Err parse(QIODevice* device);
+    Err parse(const MxmlEventStream& stream);
     QString errors() const { return _errors; }
 
     // part specific data interface functions
@@ -317,7 +317,7 @@ private:
 
     // generic pass 2 data
 
-    QXmlStreamReader _e;
+    MxmlStreamReader _e;
     int _divs;                            // the current divisions value
     Score* const _score;                  // the score
     MusicXMLParserPass1& _pass1;          // the pass1 results
@@ -369,13 +369,13 @@ private:
 class MusicXMLParserDirection
 {
 public:
-    MusicXMLParserDirection(QXmlStreamReader& e, Score* score, MusicXMLParserPass1& pass1, MusicXMLParserPass2& pass2, MxmlLogger* logger);
+    MusicXMLParserDirection(MxmlStreamReader& e, Score* score, MusicXMLParserPass1& pass1, MusicXMLParserPass2& pass2, MxmlLogger* logger);
     void direction(const QString& partId, Measure* measure, const Fraction& tick, MusicXmlSpannerMap& spanners,
                    DelayedDirectionsList& delayedDirections);
     qreal totalY() const { return _defaultY + _relativeY; }
 
 private:
-    QXmlStreamReader& _e;
+    MxmlStreamReader& _e;
     Score* const _score;                        // the score
     MusicXMLParserPass1& _pass1;                // the pass1 results
     MusicXMLParserPass2& _pass2;                // the pass2 results
@@ -0,0 +1,335 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "importmxmlreader.h"
+
+#include <algorithm>
+
+#include <QHash>
+#include <QIODevice>
+
+#include "log.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   internName
+//---------------------------------------------------------
+
+static int internName(QHash<QString, int>& indexes, std::vector<QString>& names, const QStringRef& name)
+{
+    const QString str = name.toString();
+    auto it = indexes.constFind(str);
+    if (it != indexes.constEnd()) {
+        return it.value();
+    }
+
+    const int index = static_cast<int>(names.size());
+    names.push_back(str);
+    indexes.insert(str, index);
+    return index;
+}
+
+//---------------------------------------------------------
+//   read
+//---------------------------------------------------------
+
+/**
+ Tokenize the MusicXML document in \a device.
+ Only the events an import pass can observe are kept: start and end elements
+ and the character data that readElementText() may return.
+ */
+
+void MxmlEventStream::read(QIODevice* device)
+{
+    TRACEFUNC;
+
+    m_events.clear();
+    m_attributes.clear();
+    m_names.clear();
+    m_text.clear();
+
+    QHash<QString, int> nameIndexes;
+    QXmlStreamReader reader(device);
+
+    auto addEvent = [this, &reader](QXmlStreamReader::TokenType type, int name, int first, int count) {
+        m_events.push_back({ type, name, first, count,
+                             static_cast<int>(reader.lineNumber()), static_cast<int>(reader.columnNumber()) });
+    };
+
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QXmlStreamReader::StartElement: {
+            const int first = static_cast<int>(m_attributes.size());
+            const QXmlStreamAttributes attributes = reader.attributes();
+            for (const QXmlStreamAttribute& attribute : attributes) {
+                const int name = internName(nameIndexes, m_names, attribute.qualifiedName());
+                m_attributes.push_back({ name, m_text.size(), attribute.value().size() });
+                m_text.append(attribute.value());
+            }
+            addEvent(QXmlStreamReader::StartElement, internName(nameIndexes, m_names, reader.name()), first, attributes.size());
+            break;
+        }
+        case QXmlStreamReader::EndElement:
+            addEvent(QXmlStreamReader::EndElement, internName(nameIndexes, m_names, reader.name()), 0, 0);
+            break;
+        case QXmlStreamReader::Characters:
+        case QXmlStreamReader::EntityReference: {
+            //! NOTE Text following an end element is never read, readElementText() fails on the child element before it
+            if (m_events.empty() || m_events.back().type == QXmlStreamReader::EndElement) {
+                break;
+            }
+
+            const QStringRef text = reader.text();
+            if (m_events.back().type == QXmlStreamReader::Characters) {
+                m_events.back().count += text.size();
+                m_events.back().lineNumber = static_cast<int>(reader.lineNumber());
+                m_events.back().columnNumber = static_cast<int>(reader.columnNumber());
+            } else {
+                addEvent(QXmlStreamReader::Characters, -1, m_text.size(), text.size());
+            }
+            m_text.append(text);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    m_hasError = reader.hasError();
+}
+
+//---------------------------------------------------------
+//   setEventStream
+//---------------------------------------------------------
+
+void MxmlStreamReader::setEventStream(const MxmlEventStream* stream)
+{
+    m_stream = stream;
+    m_pos = 0;
+    m_hasError = false;
+    m_attributes.clear();
+    m_attributesPos = 0;
+}
+
+//---------------------------------------------------------
+//   current
+//---------------------------------------------------------
+
+const MxmlEventStream::Event* MxmlStreamReader::current() const
+{
+    if (!m_stream || m_pos == 0 || m_pos > m_stream->m_events.size()) {
+        return nullptr;
+    }
+    return &m_stream->m_events[m_pos - 1];
+}
+
+//---------------------------------------------------------
+//   readNext
+//---------------------------------------------------------
+
+/**
+ Advance to the next event, return false at the end of the stream or after an error.
+ */
+
+bool MxmlStreamReader::readNext()
+{
+    if (!m_stream || m_hasError || m_pos > m_stream->m_events.size()) {
+        return false;
+    }
+    ++m_pos;
+    return m_pos <= m_stream->m_events.size();
+}
+
+//---------------------------------------------------------
+//   readNextStartElement
+//---------------------------------------------------------
+
+/**
+ Read until the next start element within the current element.
+ Return false when the end element was reached instead.
+ */
+
+bool MxmlStreamReader::readNextStartElement()
+{
+    while (readNext()) {
+        if (isEndElement()) {
+            return false;
+        } else if (isStartElement()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   readElementText
+//---------------------------------------------------------
+
+/**
+ Read the text of the current start element up to its end element.
+ As in QXmlStreamReader, a child element is an error, which ends the reading.
+ */
+
+QString MxmlStreamReader::readElementText()
+{
+    if (!isStartElement()) {
+        return QString();
+    }
+
+    QString result;
+    while (readNext()) {
+        const MxmlEventStream::Event* event = current();
+        switch (event->type) {
+        case QXmlStreamReader::Characters:
+            result.append(m_stream->m_text.midRef(event->first, event->count));
+            break;
+        case QXmlStreamReader::EndElement:
+            return result;
+        default:
+            m_hasError = true;
+            return result;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   skipCurrentElement
+//---------------------------------------------------------
+
+void MxmlStreamReader::skipCurrentElement()
+{
+    int depth = 1;
+    while (depth && readNext()) {
+        if (isEndElement()) {
+            --depth;
+        } else if (isStartElement()) {
+            ++depth;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   tokenType
+//---------------------------------------------------------
+
+QXmlStreamReader::TokenType MxmlStreamReader::tokenType() const
+{
+    if (m_hasError) {
+        return QXmlStreamReader::Invalid;
+    }
+    if (const MxmlEventStream::Event* event = current()) {
+        return event->type;
+    }
+    if (m_pos == 0) {
+        return QXmlStreamReader::NoToken;
+    }
+    return m_stream->m_hasError ? QXmlStreamReader::Invalid : QXmlStreamReader::EndDocument;
+}
+
+//---------------------------------------------------------
+//   tokenString
+//---------------------------------------------------------
+
+QString MxmlStreamReader::tokenString() const
+{
+    switch (tokenType()) {
+    case QXmlStreamReader::NoToken: return "NoToken";
+    case QXmlStreamReader::Invalid: return "Invalid";
+    case QXmlStreamReader::EndDocument: return "EndDocument";
+    case QXmlStreamReader::StartElement: return "StartElement";
+    case QXmlStreamReader::EndElement: return "EndElement";
+    case QXmlStreamReader::Characters: return "Characters";
+    default: break;
+    }
+    return QString();
+}
+
+//---------------------------------------------------------
+//   name
+//---------------------------------------------------------
+
+/**
+ Return the name of the current start or end element, the reference is valid as long as the event stream.
+ */
+
+QStringRef MxmlStreamReader::name() const
+{
+    const MxmlEventStream::Event* event = current();
+    if (!event || m_hasError || event->name < 0) {
+        return QStringRef();
+    }
+    return QStringRef(&m_stream->m_names[event->name]);
+}
+
+//---------------------------------------------------------
+//   attributes
+//---------------------------------------------------------
+
+/**
+ Return the attributes of the current start element,
+ they are only built on the first request for the element.
+ */
+
+QXmlStreamAttributes MxmlStreamReader::attributes() const
+{
+    if (!isStartElement()) {
+        return QXmlStreamAttributes();
+    }
+
+    if (m_attributesPos != m_pos) {
+        const MxmlEventStream::Event* event = current();
+        m_attributes.clear();
+        m_attributes.reserve(event->count);
+        for (int i = event->first; i < event->first + event->count; ++i) {
+            const MxmlEventStream::Attribute& attribute = m_stream->m_attributes[i];
+            m_attributes.append(m_stream->m_names[attribute.name], m_stream->m_text.mid(attribute.offset, attribute.length));
+        }
+        m_attributesPos = m_pos;
+    }
+    return m_attributes;
+}
+
+//---------------------------------------------------------
+//   lineNumber
+//---------------------------------------------------------
+
+qint64 MxmlStreamReader::lineNumber() const
+{
+    if (!m_stream || m_stream->m_events.empty() || m_pos == 0) {
+        return 1;
+    }
+    return m_stream->m_events[std::min(m_pos, m_stream->m_events.size()) - 1].lineNumber;
+}
+
+//---------------------------------------------------------
+//   columnNumber
+//---------------------------------------------------------
+
+qint64 MxmlStreamReader::columnNumber() const
+{
+    if (!m_stream || m_stream->m_events.empty() || m_pos == 0) {
+        return 0;
+    }
+    return m_stream->m_events[std::min(m_pos, m_stream->m_events.size()) - 1].columnNumber;
+}
+} // namespace mu::engraving
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __IMPORTMXMLREADER_H__
+#define __IMPORTMXMLREADER_H__
+
+#include <vector>
+
+#include <QString>
+#include <QXmlStreamReader>
+
+class QIODevice;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   MxmlEventStream
+//---------------------------------------------------------
+
+/**
+ The elements and the text of a MusicXML document, tokenized once
+ and replayed by an MxmlStreamReader for each import pass.
+ Element and attribute names are interned, all text is kept in one buffer.
+ */
+
+class MxmlEventStream
+{
+public:
+    void read(QIODevice* device);
+
+    size_t size() const { return m_events.size(); }
+
+private:
+    friend class MxmlStreamReader;
+
+    struct Event {
+        QXmlStreamReader::TokenType type = QXmlStreamReader::NoToken;
+        int name = -1;            ///< Interned element name
+        int first = 0;            ///< First attribute, or the offset of the text
+        int count = 0;            ///< Number of attributes, or the length of the text
+        int lineNumber = 0;
+        int columnNumber = 0;
+    };
+
+    struct Attribute {
+        int name = -1;            ///< Interned qualified name
+        int offset = 0;
+        int length = 0;
+    };
+
+    std::vector<Event> m_events;
+    std::vector<Attribute> m_attributes;
+    std::vector<QString> m_names;
+    QString m_text;
+    bool m_hasError = false;      ///< The document is not well-formed, the events end where the error was found
+};
+
+//---------------------------------------------------------
+//   MxmlStreamReader
+//---------------------------------------------------------
+
+/**
+ Reads an MxmlEventStream with the part of the QXmlStreamReader interface
+ the importer uses, with the same semantics.
+ */
+
+class MxmlStreamReader
+{
+public:
+    void setEventStream(const MxmlEventStream* stream);
+
+    bool readNextStartElement();
+    QString readElementText();
+    void skipCurrentElement();
+
+    bool isStartElement() const { return tokenType() == QXmlStreamReader::StartElement; }
+    bool isEndElement() const { return tokenType() == QXmlStreamReader::EndElement; }
+    QXmlStreamReader::TokenType tokenType() const;
+    QString tokenString() const;
+
+    QStringRef name() const;
+    QXmlStreamAttributes attributes() const;
+
+    qint64 lineNumber() const;
+    qint64 columnNumber() const;
+
+private:
+    bool readNext();
+    const MxmlEventStream::Event* current() const;
+
+    const MxmlEventStream* m_stream = nullptr;
+    size_t m_pos = 0;             ///< One past the current event, 0 before the first one
+    bool m_hasError = false;
+
+    mutable QXmlStreamAttributes m_attributes;
+    mutable size_t m_attributesPos = 0;
+};
+} // namespace mu::engraving
+
+#endif
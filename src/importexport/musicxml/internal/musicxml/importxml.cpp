@@ -104,6 +104,22 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     return true;
 }
 
+//---------------------------------------------------------
+//   musicXmlSchema
+//---------------------------------------------------------
+
+/**
+ Return the MusicXML schema, which is loaded once for the process lifetime,
+ or nullptr if it could not be loaded.
+ */
+
+static const QXmlSchema* musicXmlSchema()
+{
+    static QXmlSchema schema;
+    static const bool isValid = initMusicXmlSchema(schema);
+    return isValid ? &schema : nullptr;
+}
+
 //---------------------------------------------------------
 //   musicXMLValidationErrorDialog
 //---------------------------------------------------------
@@ -194,24 +210,21 @@ static Err doValidate(const QString& name, QIODevice* dev)
     //QElapsedTimer t;
     //t.start();
 
-    // initialize the schema
-    ValidatorMessageHandler messageHandler;
-    QXmlSchema schema;
-    schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
+    // get the schema
+    const QXmlSchema* schema = musicXmlSchema();
+    if (!schema) {
         return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
     }
     // validate the data
-    QXmlSchemaValidator validator(schema);
+    ValidatorMessageHandler messageHandler;
+    QXmlSchemaValidator validator(*schema);
+    validator.setMessageHandler(&messageHandler);
     bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
     //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
     if (!valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
         QString strErr = qtrc("iex_musicxml", "File “%1” is not a valid MusicXML file.").arg(name);
-        if (MScore::noGui) {
-            return Err::NoError;         // might as well try anyhow in converter mode
-        }
         if (musicXMLValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
             return Err::UserAbort;
         }
@@ -226,18 +239,21 @@ static Err doValidate(const QString& name, QIODevice* dev)
 
 /**
  Validate and import MusicXML data from file \a name contained in QIODevice \a dev into score \a score.
+ The validation is skipped in converter mode, where an invalid file is imported anyway.
  */
 
 static Err doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
 {
     // validate the file
-    Err res = doValidate(name, dev);
-    if (res != Err::NoError) {
-        return res;
+    if (!MScore::noGui) {
+        Err res = doValidate(name, dev);
+        if (res != Err::NoError) {
+            return res;
+        }
     }
 
     // actually do the import
-    res = importMusicXMLfromBuffer(score, name, dev);
+    Err res = importMusicXMLfromBuffer(score, name, dev);
     //LOGD("res %d", static_cast<int>(res));
     return res;
 }
@@ -31,6 +31,7 @@
 #include "types/symnames.h"
 
 #include "musicxmlsupport.h"
+#include "importmxmlreader.h"
 
 #include "log.h"
 
@@ -338,7 +339,7 @@ QString errorStringWithLocation(int line, int col, const QString& error)
 //   checkAtEndElement
 //---------------------------------------------------------
 
-QString checkAtEndElement(const QXmlStreamReader& e, const QString& expName)
+QString checkAtEndElement(const MxmlStreamReader& e, const QString& expName)
 {
     if (e.isEndElement() && e.name() == expName) {
         return "";
@@ -23,6 +23,7 @@
 #include "ove.h"
 
 #include <QFile>
+#include <QMap>
 #include <QtMath>
 
 #include "engraving/engravingerrors.h"
@@ -208,7 +209,7 @@ public:
     ~OveToMScore();
 
 public:
-    void convert(ovebase::OveSong* oveData, Score* score);
+    bool convert(ovebase::OveSong* oveData, ovebase::IOVEStreamLoader* loader, Score* score);
 
 private:
     void createStructure();
@@ -218,8 +219,12 @@ private:
     void convertTrackElements(int track);
     void convertLineBreak();
     void convertSignatures();
-    void convertMeasures();
+    void convertBarSignatures(int bar);
+    void convertDefaultKeys();
+    void convertTempos();
+    bool convertMeasures();
     void convertMeasure(Measure* measure);
+    void collectOctaveShifts(int bar);
     void convertMeasureMisc(Measure* measure, int part, int staff, int track);
     void convertNotes(Measure* measure, int part, int staff, int track);
     void convertArticulation(Measure* measure, Chord* cr, int track, int absTick, ovebase::Articulation* art);
@@ -244,17 +249,30 @@ private:
 
 private:
     ovebase::OveSong* m_ove;
+    ovebase::IOVEStreamLoader* m_loader;
     Score* m_score;
     MeasureToTick* m_mtt;
 
     Pedal* m_pedal;
+
+    // collected while the bars are loaded, converted once all of them are
+    struct OctaveShiftPoint {
+        int m_absTick;
+        ovebase::OctaveShiftType m_type;
+        ovebase::OctaveShiftPosition m_position;
+    };
+    QMap<int, QList<OctaveShiftPoint> > m_octaveShifts;
+    std::map<int, double> m_tempos;
+    bool m_keyCreated;
 };
 
 OveToMScore::OveToMScore()
 {
     m_ove = 0;
+    m_loader = 0;
     m_mtt = new MeasureToTick();
     m_pedal = 0;
+    m_keyCreated = false;
 }
 
 OveToMScore::~OveToMScore()
@@ -262,9 +280,10 @@ OveToMScore::~OveToMScore()
     delete m_mtt;
 }
 
-void OveToMScore::convert(ovebase::OveSong* ove, Score* score)
+bool OveToMScore::convert(ovebase::OveSong* ove, ovebase::IOVEStreamLoader* loader, Score* score)
 {
     m_ove = ove;
+    m_loader = loader;
     m_score = score;
     m_mtt->build(m_ove, m_ove->getQuarter());
 
@@ -288,7 +307,13 @@ void OveToMScore::convert(ovebase::OveSong* ove, Score* score)
         staffCount += partStaffCount;
     }
 
-    convertMeasures();
+    if (!convertMeasures()) {
+        clearUp();
+        return false;
+    }
+
+    convertDefaultKeys();
+    convertTempos();
 
     // convert elements by ove track sequence
     staffCount = 0;
@@ -305,6 +330,8 @@ void OveToMScore::convert(ovebase::OveSong* ove, Score* score)
     }
 
     clearUp();
+
+    return true;
 }
 
 void OveToMScore::createStructure()
@@ -696,64 +723,79 @@ static OttavaType OctaveShiftTypeToInt(ovebase::OctaveShiftType type)
     return subtype;
 }
 
-void OveToMScore::convertTrackElements(int track)
+void OveToMScore::collectOctaveShifts(int bar)
 {
-    Ottava* ottava = 0;
-
-    for (int i = 0; i < m_ove->getTrackBarCount(); ++i) {
-        ovebase::MeasureData* measureData = m_ove->getMeasureData(track, i);
+    for (int track = 0; track < m_ove->getTrackCount(); ++track) {
+        ovebase::MeasureData* measureData = m_ove->getMeasureData(track, bar);
         if (measureData == 0) {
             continue;
         }
 
-        // octave shift
         QList<ovebase::MusicData*> octaves = measureData->getMusicDatas(ovebase::MusicDataType::OctaveShift_EndPoint);
         for (int j = 0; j < octaves.size(); ++j) {
             ovebase::OctaveShiftEndPoint* octave = static_cast<ovebase::OctaveShiftEndPoint*>(octaves[j]);
-            int absTick = m_mtt->getTick(i, octave->getTick());
-
-            if (octave->getOctaveShiftPosition() == ovebase::OctaveShiftPosition::Start) {
-                if (ottava == 0) {
-                    ottava = Factory::createOttava(m_score->dummy());
-                    ottava->setTrack(track * VOICES);
-                    ottava->setOttavaType(OctaveShiftTypeToInt(octave->getOctaveShiftType()));
-
-                    int y_off = 0;
-                    switch (octave->getOctaveShiftType()) {
-                    case ovebase::OctaveShiftType::OS_8:
-                    case ovebase::OctaveShiftType::OS_15: {
-                        y_off = -3;
-                        break;
-                    }
-                    case ovebase::OctaveShiftType::OS_Minus_8:
-                    case ovebase::OctaveShiftType::OS_Minus_15: {
-                        y_off = 8;
-                        break;
-                    }
-                    default: {
-                        break;
-                    }
-                    }
+            OctaveShiftPoint point;
 
-                    if (y_off != 0) {
-                        ottava->setOffset(mu::PointF(0, y_off * m_score->style().spatium()));
-                    }
+            point.m_absTick = m_mtt->getTick(bar, octave->getTick());
+            point.m_type = octave->getOctaveShiftType();
+            point.m_position = octave->getOctaveShiftPosition();
 
-                    ottava->setTick(Fraction::fromTicks(absTick));
-                } else {
-                    LOGD("overlapping octave-shift not supported");
-                    delete ottava;
-                    ottava = 0;
+            m_octaveShifts[track].push_back(point);
+        }
+    }
+}
+
+void OveToMScore::convertTrackElements(int track)
+{
+    Ottava* ottava = 0;
+
+    // octave shift
+    const QList<OctaveShiftPoint> octaves = m_octaveShifts.value(track);
+    for (int j = 0; j < octaves.size(); ++j) {
+        const OctaveShiftPoint& octave = octaves[j];
+        int absTick = octave.m_absTick;
+
+        if (octave.m_position == ovebase::OctaveShiftPosition::Start) {
+            if (ottava == 0) {
+                ottava = Factory::createOttava(m_score->dummy());
+                ottava->setTrack(track * VOICES);
+                ottava->setOttavaType(OctaveShiftTypeToInt(octave.m_type));
+
+                int y_off = 0;
+                switch (octave.m_type) {
+                case ovebase::OctaveShiftType::OS_8:
+                case ovebase::OctaveShiftType::OS_15: {
+                    y_off = -3;
+                    break;
                 }
-            } else if (octave->getOctaveShiftPosition() == ovebase::OctaveShiftPosition::Stop) {
-                if (ottava != 0) {
-                    ottava->setTick2(Fraction::fromTicks(absTick));
-                    m_score->addSpanner(ottava);
-                    ottava->staff()->updateOttava();
-                    ottava = 0;
-                } else {
-                    LOGD("octave-shift stop without start");
+                case ovebase::OctaveShiftType::OS_Minus_8:
+                case ovebase::OctaveShiftType::OS_Minus_15: {
+                    y_off = 8;
+                    break;
+                }
+                default: {
+                    break;
+                }
+                }
+
+                if (y_off != 0) {
+                    ottava->setOffset(mu::PointF(0, y_off * m_score->style().spatium()));
                 }
+
+                ottava->setTick(Fraction::fromTicks(absTick));
+            } else {
+                LOGD("overlapping octave-shift not supported");
+                delete ottava;
+                ottava = 0;
+            }
+        } else if (octave.m_position == ovebase::OctaveShiftPosition::Stop) {
+            if (ottava != 0) {
+                ottava->setTick2(Fraction::fromTicks(absTick));
+                m_score->addSpanner(ottava);
+                ottava->staff()->updateOttava();
+                ottava = 0;
+            } else {
+                LOGD("octave-shift stop without start");
             }
         }
     }
@@ -785,7 +827,6 @@ void OveToMScore::convertSignatures()
 {
     int i;
     int j;
-    int k;
 
     // Time
     const QList<MeasureToTick::TimeTick> tts = m_mtt->getTimeTicks();
@@ -815,48 +856,77 @@ void OveToMScore::convertSignatures()
         }
     }
 
+    // start clef
+    int staffCount = 0;
+    for (i = 0; i < m_ove->getPartCount(); ++i) {
+        int partStaffCount = m_ove->getStaffCount(i);
+        for (j = 0; j < partStaffCount; ++j) {
+            Staff* staff = m_score->staff(staffCount + j);
+            if (staff) {
+                ovebase::Track* track = m_ove->getTrack(i, j);
+                ClefType clefType = OveClefToClef(track->getStartClef());
+                Measure* measure = m_score->tick2measure(Fraction(0, 1));
+                // staff->setClef(0, clefType);
+
+                // note: also generate symbol for tick 0
+                // was not necessary before 0.9.6
+                Segment* s = measure->getSegment(SegmentType::HeaderClef, Fraction(0, 1));
+                Clef* clef = Factory::createClef(s);
+                clef->setClefType(clefType);
+                clef->setTrack((staffCount + j) * VOICES);
+                s->add(clef);
+            }
+        }
+
+        staffCount += partStaffCount;
+    }
+}
+
+// keys and clefs of the bar, its tempos are collected and set once all bars are converted
+void OveToMScore::convertBarSignatures(int bar)
+{
+    int i;
+    int j;
+
     // Key
     int staffCount = 0;
-    bool createKey = false;
     for (i = 0; i < m_ove->getPartCount(); ++i) {
         int partStaffCount = m_ove->getStaffCount(i);
 
         for (j = 0; j < partStaffCount; ++j) {
             Staff& staff = *m_score->staff(staffCount + j);
-            for (k = 0; k < m_ove->getMeasureCount(); ++k) {
-                ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, k);
-
-                if (measureData != 0) {
-                    ovebase::Key* keyPtr = measureData->getKey();
-
-                    if (k == 0 || keyPtr->getKey() != keyPtr->getPreviousKey()) {
-                        Fraction tick = Fraction::fromTicks(m_mtt->getTick(k, 0));
-                        int keyValue = keyPtr->getKey();
-                        Measure* measure = m_score->tick2measure(tick);
-                        if (measure) {
-                            KeySigEvent ke;
-                            Key key = Key(keyValue);
-                            Key cKey = key;
-                            Interval v = staff.part()->instrument(tick)->transpose();
-                            if (!v.isZero() && !m_score->style().styleB(Sid::concertPitch)) {
-                                cKey = transposeKey(key, v);
-                                // if there are more than 6 accidentals in transposing key, it cannot be PreferSharpFlat::AUTO
-                                if ((key > 6 || key < -6) && staff.part()->preferSharpFlat() == PreferSharpFlat::AUTO) {
-                                    staff.part()->setPreferSharpFlat(PreferSharpFlat::NONE);
-                                }
+            ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, bar);
+
+            if (measureData != 0) {
+                ovebase::Key* keyPtr = measureData->getKey();
+
+                if (bar == 0 || keyPtr->getKey() != keyPtr->getPreviousKey()) {
+                    Fraction tick = Fraction::fromTicks(m_mtt->getTick(bar, 0));
+                    int keyValue = keyPtr->getKey();
+                    Measure* measure = m_score->tick2measure(tick);
+                    if (measure) {
+                        KeySigEvent ke;
+                        Key key = Key(keyValue);
+                        Key cKey = key;
+                        Interval v = staff.part()->instrument(tick)->transpose();
+                        if (!v.isZero() && !m_score->style().styleB(Sid::concertPitch)) {
+                            cKey = transposeKey(key, v);
+                            // if there are more than 6 accidentals in transposing key, it cannot be PreferSharpFlat::AUTO
+                            if ((key > 6 || key < -6) && staff.part()->preferSharpFlat() == PreferSharpFlat::AUTO) {
+                                staff.part()->setPreferSharpFlat(PreferSharpFlat::NONE);
                             }
-                            ke.setConcertKey(cKey);
-                            ke.setKey(key);
-                            staff.setKey(tick, ke);
+                        }
+                        ke.setConcertKey(cKey);
+                        ke.setKey(key);
+                        staff.setKey(tick, ke);
 
-                            Segment* s = measure->getSegment(SegmentType::KeySig, tick);
-                            KeySig* keysig = Factory::createKeySig(s);
-                            keysig->setTrack((staffCount + j) * VOICES);
-                            keysig->setKeySigEvent(ke);
-                            s->add(keysig);
+                        Segment* s = measure->getSegment(SegmentType::KeySig, tick);
+                        KeySig* keysig = Factory::createKeySig(s);
+                        keysig->setTrack((staffCount + j) * VOICES);
+                        keysig->setKeySigEvent(ke);
+                        s->add(keysig);
 
-                            createKey = true;
-                        }
+                        m_keyCreated = true;
                     }
                 }
             }
@@ -865,65 +935,31 @@ void OveToMScore::convertSignatures()
         staffCount += partStaffCount;
     }
 
-    if (!createKey) {
-        staffCount = 0;
-        for (i = 0; i < m_ove->getPartCount(); ++i) {
-            int partStaffCount = m_ove->getStaffCount(i);
-
-            for (j = 0; j < partStaffCount; ++j) {
-                Measure* measure = m_score->tick2measure(Fraction::fromTicks(m_mtt->getTick(0, 0)));
-                if (measure) {
-                    Segment* s = measure->getSegment(SegmentType::KeySig, Fraction(0, 1));
-                    KeySig* keysig = Factory::createKeySig(s);
-                    keysig->setTrack((staffCount + j) * VOICES);
-                    keysig->setKeySigEvent(KeySigEvent());
-                    s->add(keysig);
-                }
-            }
-            staffCount += partStaffCount;
-        }
-    }
-
     // Clef
     staffCount = 0;
     for (i = 0; i < m_ove->getPartCount(); ++i) {
         int partStaffCount = m_ove->getStaffCount(i);
         for (j = 0; j < partStaffCount; ++j) {
-            // start clef
-            Staff* staff = m_score->staff(staffCount + j);
-            if (staff) {
-                ovebase::Track* track = m_ove->getTrack(i, j);
-                ClefType clefType = OveClefToClef(track->getStartClef());
-                Measure* measure = m_score->tick2measure(Fraction(0, 1));
-                // staff->setClef(0, clefType);
-
-                // note: also generate symbol for tick 0
-                // was not necessary before 0.9.6
-                Segment* s = measure->getSegment(SegmentType::HeaderClef, Fraction(0, 1));
-                Clef* clef = Factory::createClef(s);
-                clef->setClefType(clefType);
-                clef->setTrack((staffCount + j) * VOICES);
-                s->add(clef);
+            // clef in measure
+            ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, bar);
+            if (measureData == 0) {
+                continue;
             }
 
-            // clef in measure
-            for (k = 0; k < m_ove->getMeasureCount(); ++k) {
-                ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, k);
-                QList<ovebase::MusicData*> clefs = measureData->getMusicDatas(ovebase::MusicDataType::Clef);
-                Measure* measure = m_score->tick2measure(Fraction::fromTicks(m_mtt->getTick(k, 0)));
-
-                for (int l = 0; l < clefs.size(); ++l) {
-                    if (measure != 0) {
-                        ovebase::Clef* clefPtr = static_cast<ovebase::Clef*>(clefs[l]);
-                        int absTick = m_mtt->getTick(k, clefPtr->getTick());
-                        ClefType clefType = OveClefToClef(clefPtr->getClefType());
-
-                        Segment* s = measure->getSegment(SegmentType::Clef, Fraction::fromTicks(absTick));
-                        Clef* clef = Factory::createClef(s);
-                        clef->setClefType(clefType);
-                        clef->setTrack((staffCount + j) * VOICES);
-                        s->add(clef);
-                    }
+            QList<ovebase::MusicData*> clefs = measureData->getMusicDatas(ovebase::MusicDataType::Clef);
+            Measure* measure = m_score->tick2measure(Fraction::fromTicks(m_mtt->getTick(bar, 0)));
+
+            for (int l = 0; l < clefs.size(); ++l) {
+                if (measure != 0) {
+                    ovebase::Clef* clefPtr = static_cast<ovebase::Clef*>(clefs[l]);
+                    int absTick = m_mtt->getTick(bar, clefPtr->getTick());
+                    ClefType clefType = OveClefToClef(clefPtr->getClefType());
+
+                    Segment* s = measure->getSegment(SegmentType::Clef, Fraction::fromTicks(absTick));
+                    Clef* clef = Factory::createClef(s);
+                    clef->setClefType(clefType);
+                    clef->setTrack((staffCount + j) * VOICES);
+                    s->add(clef);
                 }
             }
         }
@@ -932,37 +968,65 @@ void OveToMScore::convertSignatures()
     }
 
     // Tempo
-    std::map<int, double> tempos;
+    ovebase::Measure* measure = m_ove->getMeasure(bar);
     for (i = 0; i < m_ove->getPartCount(); ++i) {
         int partStaffCount = m_ove->getStaffCount(i);
 
         for (j = 0; j < partStaffCount; ++j) {
-            for (k = 0; k < m_ove->getMeasureCount(); ++k) {
-                ovebase::Measure* measure = m_ove->getMeasure(k);
-                ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, k);
-                QList<ovebase::MusicData*> tempoPtrs = measureData->getMusicDatas(ovebase::MusicDataType::Tempo);
-
-                if (k == 0
-                    || (k > 0 && qAbs(measure->getTypeTempo() - m_ove->getMeasure(k - 1)->getTypeTempo()) > 0.01)) {
-                    int tick = m_mtt->getTick(k, 0);
-                    tempos[tick] = measure->getTypeTempo();
-                }
+            ovebase::MeasureData* measureData = m_ove->getMeasureData(i, j, bar);
+            if (measureData == 0) {
+                continue;
+            }
 
-                for (int l = 0; l < tempoPtrs.size(); ++l) {
-                    ovebase::Tempo* ptr = static_cast<ovebase::Tempo*>(tempoPtrs[l]);
-                    int tick = m_mtt->getTick(measure->getBarNumber()->getIndex(), ptr->getTick());
-                    double tempo = ptr->getQuarterTempo() > 0 ? ptr->getQuarterTempo() : 1.0;
+            QList<ovebase::MusicData*> tempoPtrs = measureData->getMusicDatas(ovebase::MusicDataType::Tempo);
 
-                    tempos[tick] = tempo;
-                }
+            if (bar == 0
+                || (bar > 0 && qAbs(measure->getTypeTempo() - m_ove->getMeasure(bar - 1)->getTypeTempo()) > 0.01)) {
+                int tick = m_mtt->getTick(bar, 0);
+                m_tempos[tick] = measure->getTypeTempo();
+            }
+
+            for (int l = 0; l < tempoPtrs.size(); ++l) {
+                ovebase::Tempo* ptr = static_cast<ovebase::Tempo*>(tempoPtrs[l]);
+                int tick = m_mtt->getTick(measure->getBarNumber()->getIndex(), ptr->getTick());
+                double tempo = ptr->getQuarterTempo() > 0 ? ptr->getQuarterTempo() : 1.0;
+
+                m_tempos[tick] = tempo;
+            }
+        }
+    }
+}
+
+void OveToMScore::convertDefaultKeys()
+{
+    if (m_keyCreated) {
+        return;
+    }
+
+    int staffCount = 0;
+    for (int i = 0; i < m_ove->getPartCount(); ++i) {
+        int partStaffCount = m_ove->getStaffCount(i);
+
+        for (int j = 0; j < partStaffCount; ++j) {
+            Measure* measure = m_score->tick2measure(Fraction::fromTicks(m_mtt->getTick(0, 0)));
+            if (measure) {
+                Segment* s = measure->getSegment(SegmentType::KeySig, Fraction(0, 1));
+                KeySig* keysig = Factory::createKeySig(s);
+                keysig->setTrack((staffCount + j) * VOICES);
+                keysig->setKeySigEvent(KeySigEvent());
+                s->add(keysig);
             }
         }
+        staffCount += partStaffCount;
     }
+}
 
+void OveToMScore::convertTempos()
+{
     std::map<int, double>::iterator it;
     int lastTempo = 0;
-    for (it=tempos.begin(); it != tempos.end(); ++it) {
-        if (it == tempos.begin() || (*it).second != lastTempo) {
+    for (it=m_tempos.begin(); it != m_tempos.end(); ++it) {
+        if (it == m_tempos.begin() || (*it).second != lastTempo) {
             double tpo = ((*it).second) / 60.0;
             m_score->setTempo(Fraction::fromTicks((*it).first), tpo);
         }
@@ -1197,28 +1261,57 @@ ovebase::ClefType getClefType(ovebase::MeasureData* measure, int tick)
     return type;
 }
 
-void OveToMScore::convertMeasures()
+bool OveToMScore::convertMeasures()
 {
+    std::vector<Measure*> measures;
     for (MeasureBase* mb = m_score->measures()->first(); mb; mb = mb->next()) {
         if (mb->type() != ElementType::MEASURE) {
             continue;
         }
-        Measure* measure = static_cast<Measure*>(mb);
+        measures.push_back(static_cast<Measure*>(mb));
+    }
+
+    //! NOTE The note data is loaded bar by bar and released as soon as no converted bar refers to it,
+    //! so only the bars spanned by the ties, slurs, wedges etc. being converted are in memory at once
+    size_t linesIdx = 0;
+    size_t releaseIdx = 0;
+
+    for (size_t i = 0; i < measures.size(); ++i) {
+        Measure* measure = measures[i];
+        int bar = measure->no();
+
+        if (!m_loader->loadBar(bar)) {
+            return false;
+        }
+
         int tick = measure->tick().ticks();
         measure->setTicks(m_score->sigmap()->timesig(tick).timesig());
         measure->setTimesig(m_score->sigmap()->timesig(tick).timesig());     //?
+        convertBarSignatures(bar);
         convertMeasure(measure);
-    }
+        collectOctaveShifts(bar);
 
-    //  convert based on notes
-    for (MeasureBase* mb = m_score->measures()->first(); mb; mb = mb->next()) {
-        if (mb->type() != ElementType::MEASURE) {
-            continue;
+        //  convert based on notes, the notes of the bars the lines end in and of the bar after them must be converted
+        while (linesIdx < i && m_loader->getLastLinkedBar(measures[linesIdx]->no()) < bar) {
+            convertLines(measures[linesIdx++]);
         }
-        Measure* measure = static_cast<Measure*>(mb);
 
-        convertLines(measure);
+        // the lines ending in a bar look up their start in the bars before
+        while (releaseIdx < linesIdx
+               && m_loader->getLastLinkedBar(measures[releaseIdx]->no()) <= measures[linesIdx - 1]->no()) {
+            m_loader->releaseBar(measures[releaseIdx++]->no());
+        }
+    }
+
+    for (; linesIdx < measures.size(); ++linesIdx) {
+        convertLines(measures[linesIdx]);
+    }
+
+    for (; releaseIdx < measures.size(); ++releaseIdx) {
+        m_loader->releaseBar(measures[releaseIdx]->no());
     }
+
+    return true;
 }
 
 void OveToMScore::convertMeasure(Measure* measure)
@@ -2525,22 +2618,22 @@ Err importOve(MasterScore* score, const QString& name)
         return Err::FileOpenError;
     }
 
-    QByteArray buffer = oveFile.readAll();
-
-    oveFile.close();
-
+    //! NOTE The chunks are read from the file as they are parsed, so it is not loaded into memory as a whole.
+    //! The note data of the bars is read while converting, the file stays open until then
     oveSong.setTextCodecName(QString::fromStdString(ove::configuration()->importOvertureCharset()));
     oveLoader->setOve(&oveSong);
-    oveLoader->setFileStream((unsigned char*)buffer.data(), buffer.size());
+    oveLoader->setFileStream(&oveFile);
     bool result = oveLoader->load();
-    oveLoader->release();
 
     if (result) {
         OveToMScore otm;
-        otm.convert(&oveSong, score);
+        result = otm.convert(&oveSong, oveLoader, score);
 
         // score->connectSlurs();
     }
 
+    oveLoader->release();
+    oveFile.close();
+
     return result ? Err::NoError : Err::FileUnknownError;
 }
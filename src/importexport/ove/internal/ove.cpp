@@ -22,6 +22,7 @@
 
 #include "ove.h"
 
+#include <QIODevice>
 #include <QTextCodec>
 #include <QMap>
 
@@ -667,6 +668,21 @@ MeasureData* OveSong::getMeasureData(int track, int bar) const
     return 0;
 }
 
+void OveSong::setMeasureData(int track, int bar, MeasureData* ptr)
+{
+    int id = m_trackBarCount * track + bar;
+
+    if (bar >= 0 && bar < m_trackBarCount && id >= 0 && id < (int)m_measureDatas.size()) {
+        delete m_measureDatas[id];
+        m_measureDatas[id] = ptr;
+    }
+}
+
+void OveSong::releaseMeasureData(int track, int bar)
+{
+    setMeasureData(track, bar, 0);
+}
+
 void OveSong::setPartStaffCounts(const QList<int>& partStaffCounts)
 {
     // m_partStaffCounts.assign(partStaffCounts.begin(), partStaffCounts.end());
@@ -3984,6 +4000,54 @@ bool StreamHandle::write(char* /* buff */, int /* size */)
     return true;
 }
 
+qint64 StreamHandle::pos() const
+{
+    return m_curPos;
+}
+
+bool StreamHandle::seek(qint64 pos)
+{
+    if (m_point == NULL || pos < 0 || pos > m_size) {
+        return false;
+    }
+
+    m_curPos = static_cast<int>(pos);
+
+    return true;
+}
+
+DeviceStreamHandle::DeviceStreamHandle(QIODevice* device)
+    : StreamHandle(), m_device(device)
+{
+}
+
+bool DeviceStreamHandle::read(char* buff, int size)
+{
+    if (m_device == NULL || size < 0) {
+        return false;
+    }
+
+    return m_device->read(buff, size) == size;
+}
+
+qint64 DeviceStreamHandle::pos() const
+{
+    if (m_device == NULL) {
+        return 0;
+    }
+
+    return m_device->pos();
+}
+
+bool DeviceStreamHandle::seek(qint64 pos)
+{
+    if (m_device == NULL || pos < 0 || pos > m_device->size()) {
+        return false;
+    }
+
+    return m_device->seek(pos);
+}
+
 Block::Block()
 {
     doResize(0);
@@ -4801,6 +4865,7 @@ PageGroupParse::PageGroupParse(OveSong* ove)
 
 PageGroupParse::~PageGroupParse()
 {
+    qDeleteAll(m_pageChunks);
     m_pageChunks.clear();
 }
 
@@ -4953,7 +5018,9 @@ LineGroupParse::LineGroupParse(OveSong* ove)
 LineGroupParse::~LineGroupParse()
 {
     m_chunk = NULL;
+    qDeleteAll(m_lineChunks);
     m_lineChunks.clear();
+    qDeleteAll(m_staffChunks);
     m_staffChunks.clear();
 }
 
@@ -5139,99 +5206,84 @@ BarsParse::BarsParse(OveSong* ove)
 
 BarsParse::~BarsParse()
 {
-    m_measureChunks.clear();
-    m_conductChunks.clear();
-    m_bdatChunks.clear();
-}
-
-void BarsParse::addMeasure(SizeChunk* chunk)
-{
-    m_measureChunks.push_back(chunk);
-}
-
-void BarsParse::addConduct(SizeChunk* chunk)
-{
-    m_conductChunks.push_back(chunk);
-}
-
-void BarsParse::addBdat(SizeChunk* chunk)
-{
-    m_bdatChunks.push_back(chunk);
 }
 
-bool BarsParse::parse()
+bool BarsParse::createMeasures(int measureCount)
 {
     int i;
-    int trackMeasureCount = m_ove->getTrackBarCount();
     int trackCount = m_ove->getTrackCount();
-    int measureDataCount = trackCount * m_measureChunks.size();
-    QList<Measure*> measures;
-    QList<MeasureData*> measureDatas;
+    int measureDataCount = trackCount * measureCount;
 
-    if (m_measureChunks.isEmpty()
-        || m_measureChunks.size() != m_conductChunks.size()
-        || m_bdatChunks.size() != measureDataCount) {
+    if (measureCount <= 0) {
         return false;
     }
 
     // add to ove
-    for (i = 0; i < m_measureChunks.size(); ++i) {
+    for (i = 0; i < measureCount; ++i) {
         Measure* measure = new Measure(i);
 
-        measures.push_back(measure);
         m_ove->addMeasure(measure);
     }
 
+    // the measure datas are created when their bar is loaded
     for (i = 0; i < measureDataCount; ++i) {
-        MeasureData* oveMeasureData = new MeasureData();
-
-        measureDatas.push_back(oveMeasureData);
-        m_ove->addMeasureData(oveMeasureData);
+        m_ove->addMeasureData(0);
     }
 
-    for (i = 0; i < m_measureChunks.size(); ++i) {
-        Measure* measure = measures[i];
+    return true;
+}
 
-        // MEAS
-        if (!parseMeas(measure, m_measureChunks[i])) {
-            QString ss = QString("failed in parse MEAS %1\n").arg(i);
-            messageOut(ss);
+bool BarsParse::parseMeasureChunk(int measureIndex, SizeChunk* chunk)
+{
+    // MEAS
+    if (!parseMeas(m_ove->getMeasure(measureIndex), chunk)) {
+        QString ss = QString("failed in parse MEAS %1\n").arg(measureIndex);
+        messageOut(ss);
 
-            return false;
-        }
+        return false;
     }
 
-    for (i = 0; i < m_conductChunks.size(); ++i) {
-        // COND
-        if (!parseCond(measures[i], measureDatas[i], m_conductChunks[i])) {
-            QString ss = QString("failed in parse COND %1\n").arg(i);
-            messageOut(ss);
+    return true;
+}
 
-            return false;
-        }
+bool BarsParse::parseConductChunk(int measureIndex, SizeChunk* chunk)
+{
+    // COND
+    MeasureData* measureData = m_ove->getMeasureData(0, measureIndex);
+    if (measureData == 0 || !parseCond(m_ove->getMeasure(measureIndex), measureData, chunk)) {
+        QString ss = QString("failed in parse COND %1\n").arg(measureIndex);
+        messageOut(ss);
+
+        return false;
     }
 
-    for (i = 0; i < m_bdatChunks.size(); ++i) {
-        int measId = i % trackMeasureCount;
+    return true;
+}
 
-        // BDAT
-        if (!parseBdat(measures[measId], measureDatas[i], m_bdatChunks[i])) {
-            QString ss = QString("failed in parse BDAT %1\n").arg(i);
-            messageOut(ss);
+bool BarsParse::parseBdatChunk(int index, SizeChunk* chunk)
+{
+    int trackMeasureCount = m_ove->getTrackBarCount();
+    int trackCount = m_ove->getTrackCount();
+    int measId = index % trackMeasureCount;
+    MeasureData* measureData = m_ove->getMeasureData(index / trackMeasureCount, measId);
 
-            return false;
-        }
+    // BDAT
+    if (measureData == 0 || !parseBdat(m_ove->getMeasure(measId), measureData, chunk)) {
+        QString ss = QString("failed in parse BDAT %1\n").arg(index);
+        messageOut(ss);
 
-        if (m_notify != NULL) {
-            int measureID = i % trackMeasureCount;
-            int trackID = i / trackMeasureCount;
+        return false;
+    }
 
-            //msg.m_msg = OVE_IMPORT_POS;
-            //msg.m_param1 = (measureID<<16) + trackMeasureCount;
-            //msg.m_param2 = (trackID<<16) + trackCount;
+    if (m_notify != NULL) {
+        int measureID = index % trackMeasureCount;
+        int trackID = index / trackMeasureCount;
 
-            m_notify->loadPosition(measureID, trackMeasureCount, trackID, trackCount);
-        }
+        //msg.m_msg = OVE_IMPORT_POS;
+        //msg.m_param1 = (measureID<<16) + trackMeasureCount;
+        //msg.m_param2 = (trackID<<16) + trackCount;
+
+        m_notify->loadPosition(measureID, trackMeasureCount, trackID, trackCount);
     }
 
     return true;
@@ -9411,7 +9463,9 @@ bool LyricChunkParse::parse()
             }
         }
 
-        processLyricInfo(info);
+        // the words are set to the lyrics of the bars as they are loaded
+        info.m_words = info.m_lyric.split(" ", Qt::SkipEmptyParts);
+        m_lyricInfos.push_back(info);
     }
 
     return true;
@@ -9422,56 +9476,54 @@ bool isSpace(char c)
     return c == ' ' || c == '\n';
 }
 
-void LyricChunkParse::processLyricInfo(const LyricInfo& info)
+void LyricChunkParse::processBar(int bar)
+{
+    for (int i = 0; i < m_lyricInfos.size(); ++i) {
+        processLyricInfo(m_lyricInfos[i], bar);
+    }
+}
+
+void LyricChunkParse::processLyricInfo(LyricInfo& info, int bar)
 {
     int i;
     int j;
-    int index = 0; // words
+    const QStringList& words = info.m_words;
 
-    int measureId = info.m_measure - 1;
-    bool changeMeasure = true;
-    MeasureData* measureData = 0;
-    int trackMeasureCount = m_ove->getTrackBarCount();
-    QStringList words = info.m_lyric.split(" ", Qt::SkipEmptyParts);
+    // the words start at the measure of the lyric and continue in the following bars until they are used up
+    if (bar < info.m_measure || info.m_wordIndex >= words.size()) {
+        return;
+    }
 
-    while (index < words.size() && measureId + 1 < trackMeasureCount) {
-        if (changeMeasure) {
-            ++measureId;
-            measureData = m_ove->getMeasureData(info.m_track, measureId);
-            changeMeasure = false;
-        }
+    MeasureData* measureData = m_ove->getMeasureData(info.m_track, bar);
+    if (measureData == 0) {
+        return;
+    }
 
-        if (measureData == 0) {
-            return;
+    QList<NoteContainer*> containers = measureData->getNoteContainers();
+    QList<MusicData*> lyrics = measureData->getMusicDatas(MusicDataType::Lyric);
+
+    for (i = 0; i < containers.size() && info.m_wordIndex < words.size(); ++i) {
+        if (containers[i]->getIsRest()) {
+            continue;
         }
-        QList<NoteContainer*> containers = measureData->getNoteContainers();
-        QList<MusicData*> lyrics = measureData->getMusicDatas(MusicDataType::Lyric);
 
-        for (i = 0; i < containers.size() && index < words.size(); ++i) {
-            if (containers[i]->getIsRest()) {
-                continue;
-            }
+        for (j = 0; j < lyrics.size(); ++j) {
+            Lyric* lyric = static_cast<Lyric*>(lyrics[j]);
 
-            for (j = 0; j < lyrics.size(); ++j) {
-                Lyric* lyric = static_cast<Lyric*>(lyrics[j]);
-
-                if (containers[i]->start()->getOffset() == lyric->start()->getOffset()
-                    && (int)containers[i]->getVoice() == info.m_voice
-                    && lyric->getVerse() == info.m_verse) {
-                    if (index < words.size()) {
-                        QString l = words[index].trimmed();
-                        if (!l.isEmpty()) {
-                            lyric->setLyric(l);
-                            lyric->setVoice(info.m_voice);
-                        }
+            if (containers[i]->start()->getOffset() == lyric->start()->getOffset()
+                && (int)containers[i]->getVoice() == info.m_voice
+                && lyric->getVerse() == info.m_verse) {
+                if (info.m_wordIndex < words.size()) {
+                    QString l = words[info.m_wordIndex].trimmed();
+                    if (!l.isEmpty()) {
+                        lyric->setLyric(l);
+                        lyric->setVoice(info.m_voice);
                     }
-
-                    ++index;
                 }
+
+                ++info.m_wordIndex;
             }
         }
-
-        changeMeasure = true;
     }
 }
 
@@ -9628,82 +9680,68 @@ void OveOrganizer::organize()
     }
 
     organizeTracks();
-    organizeAttributes();
-    organizeMeasures();
 }
 
-void OveOrganizer::organizeAttributes()
+void OveOrganizer::organizeAttributes(int bar)
 {
     int i;
-    int j;
     int k;
 
-    // key
-    if (m_ove->getLineCount() > 0) {
-        Line* line = m_ove->getLine(0);
-        int partBarCount = m_ove->getPartBarCount();
-        int lastKey = 0;
-
-        if (line != 0) {
-            for (i = 0; i < line->getStaffCount(); ++i) {
-                QPair<int, int> partStaff = m_ove->trackToPartStaff(i);
-                Staff* staff = line->getStaff(i);
-                lastKey = staff->getKeyType();
-
-                for (j = 0; j < partBarCount; ++j) {
-                    MeasureData* measureData = m_ove->getMeasureData(partStaff.first, partStaff.second, j);
-
-                    if (measureData != 0) {
-                        Key* key = measureData->getKey();
-
-                        if (j == 0) {
-                            key->setKey(lastKey);
-                            key->setPreviousKey(lastKey);
-                        }
-
-                        if (!key->getSetKey()) {
-                            key->setKey(lastKey);
-                            key->setPreviousKey(lastKey);
-                        } else {
-                            if (key->getKey() != lastKey) {
-                                lastKey = key->getKey();
-                            }
-                        }
-                    }
-                }
-            }
+    if (m_ove == NULL || m_ove->getLineCount() == 0) {
+        return;
+    }
+
+    Line* line = m_ove->getLine(0);
+    if (line == 0) {
+        return;
+    }
+
+    if (bar == 0) {
+        m_lastKeys.clear();
+        m_lastClefTypes.clear();
+
+        for (i = 0; i < line->getStaffCount(); ++i) {
+            Staff* staff = line->getStaff(i);
+            m_lastKeys.push_back(staff->getKeyType());
+            m_lastClefTypes.push_back(staff->getClefType());
         }
     }
 
-    // clef
-    if (m_ove->getLineCount() > 0) {
-        Line* line = m_ove->getLine(0);
-        int partBarCount = m_ove->getPartBarCount();
-        ClefType lastClefType = ClefType::Treble;
-
-        if (line != 0) {
-            for (i = 0; i < line->getStaffCount(); ++i) {
-                QPair<int, int> partStaff = m_ove->trackToPartStaff(i);
-                Staff* staff = line->getStaff(i);
-                lastClefType = staff->getClefType();
-
-                for (j = 0; j < partBarCount; ++j) {
-                    MeasureData* measureData = m_ove->getMeasureData(partStaff.first, partStaff.second, j);
-
-                    if (measureData != 0) {
-                        Clef* clefPtr = measureData->getClef();
-                        clefPtr->setClefType((int)lastClefType);
-
-                        const QList<MusicData*>& clefs = measureData->getMusicDatas(MusicDataType::Clef);
-
-                        for (k = 0; k < clefs.size(); ++k) {
-                            Clef* clef = static_cast<Clef*>(clefs[k]);
-                            lastClefType = clef->getClefType();
-                        }
-                    }
-                }
+    for (i = 0; i < line->getStaffCount() && i < m_lastKeys.size(); ++i) {
+        QPair<int, int> partStaff = m_ove->trackToPartStaff(i);
+        MeasureData* measureData = m_ove->getMeasureData(partStaff.first, partStaff.second, bar);
+
+        if (measureData == 0) {
+            continue;
+        }
+
+        // key
+        Key* key = measureData->getKey();
+
+        if (bar == 0) {
+            key->setKey(m_lastKeys[i]);
+            key->setPreviousKey(m_lastKeys[i]);
+        }
+
+        if (!key->getSetKey()) {
+            key->setKey(m_lastKeys[i]);
+            key->setPreviousKey(m_lastKeys[i]);
+        } else {
+            if (key->getKey() != m_lastKeys[i]) {
+                m_lastKeys[i] = key->getKey();
             }
         }
+
+        // clef
+        Clef* clefPtr = measureData->getClef();
+        clefPtr->setClefType((int)m_lastClefTypes[i]);
+
+        const QList<MusicData*>& clefs = measureData->getMusicDatas(MusicDataType::Clef);
+
+        for (k = 0; k < clefs.size(); ++k) {
+            Clef* clef = static_cast<Clef*>(clefs[k]);
+            m_lastClefTypes[i] = clef->getClefType();
+        }
     }
 }
 
@@ -9766,18 +9804,20 @@ void OveOrganizer::organizeTracks()
     m_ove->setPartStaffCounts(partStaffCounts);
 }
 
-void OveOrganizer::organizeMeasures()
+void OveOrganizer::organizeMeasures(int bar)
 {
-    int trackBarCount = m_ove->getTrackBarCount();
+    Measure* measure = m_ove->getMeasure(bar);
+    if (measure == 0) {
+        return;
+    }
 
     for (int i = 0; i < m_ove->getPartCount(); ++i) {
         int partStaffCount = m_ove->getStaffCount(i);
 
         for (int j = 0; j < partStaffCount; ++j) {
-            for (int k = 0; k < trackBarCount; ++k) {
-                Measure* measure = m_ove->getMeasure(k);
-                MeasureData* measureData = m_ove->getMeasureData(i, j, k);
+            MeasureData* measureData = m_ove->getMeasureData(i, j, bar);
 
+            if (measureData != 0) {
                 organizeMeasure(i, j, measure, measureData);
             }
         }
@@ -10204,12 +10244,21 @@ int chunkTypeToMaxTimes(ChunkType type)
 OveSerialize::OveSerialize()
     : m_ove(0),
     m_streamHandle(0),
-    m_notify(0)
+    m_notify(0),
+    m_barsParse(0),
+    m_lyricParse(0),
+    m_organizer(0),
+    m_readBarCount(0),
+    m_organizedBarCount(0)
 {
 }
 
 OveSerialize::~OveSerialize()
 {
+    delete m_barsParse;
+    delete m_lyricParse;
+    delete m_organizer;
+
     if (m_streamHandle != 0) {
         delete m_streamHandle;
         m_streamHandle = 0;
@@ -10223,9 +10272,16 @@ void OveSerialize::setOve(OveSong* ove)
 
 void OveSerialize::setFileStream(unsigned char* buffer, unsigned int size)
 {
+    delete m_streamHandle;
     m_streamHandle = new StreamHandle(buffer, size);
 }
 
+void OveSerialize::setFileStream(QIODevice* device)
+{
+    delete m_streamHandle;
+    m_streamHandle = new DeviceStreamHandle(device);
+}
+
 void OveSerialize::setNotify(IOveNotify* notify)
 {
     m_notify = notify;
@@ -10342,10 +10398,13 @@ bool OveSerialize::load(void)
                 return false;
             }
 
-            LyricChunkParse parse(m_ove);
+            // the lyrics are kept until the bars they are set to are loaded
+            delete m_lyricParse;
+            m_lyricParse = new LyricChunkParse(m_ove);
 
-            parse.setLyricChunk(&lyricChunk);
-            parse.parse();
+            m_lyricParse->setLyricChunk(&lyricChunk);
+            m_lyricParse->parse();
+            m_lyricParse->setLyricChunk(0);
 
             break;
         }
@@ -10400,9 +10459,114 @@ bool OveSerialize::load(void)
     }
     */
 
-    // organize OveData
-    OveOrganizer organizer(m_ove);
-    organizer.organize();
+    // organize OveData, the bars are organized as they are loaded
+    delete m_organizer;
+    m_organizer = new OveOrganizer(m_ove);
+    m_organizer->organize();
+
+    m_readBarCount = 0;
+    m_organizedBarCount = 0;
+    m_lastLinkedBars.clear();
+
+    return true;
+}
+
+bool OveSerialize::loadBar(int bar)
+{
+    if (m_barsParse == 0 || m_organizer == 0 || bar < 0 || bar >= m_ove->getTrackBarCount()) {
+        return false;
+    }
+
+    while (m_organizedBarCount <= bar) {
+        int organizeBar = m_organizedBarCount;
+
+        if (m_readBarCount <= organizeBar && !readBar(m_readBarCount)) {
+            return false;
+        }
+
+        // the cross measure elements are added to the bars they end in
+        int lastLinkedBar = m_lastLinkedBars[organizeBar];
+        while (m_readBarCount <= lastLinkedBar) {
+            if (!readBar(m_readBarCount)) {
+                return false;
+            }
+        }
+
+        m_organizer->organizeMeasures(organizeBar);
+        ++m_organizedBarCount;
+    }
+
+    return true;
+}
+
+int OveSerialize::getLastLinkedBar(int bar) const
+{
+    if (bar >= 0 && bar < m_lastLinkedBars.size()) {
+        return m_lastLinkedBars[bar];
+    }
+
+    return bar;
+}
+
+void OveSerialize::releaseBar(int bar)
+{
+    for (int i = 0; i < m_ove->getTrackCount(); ++i) {
+        m_ove->releaseMeasureData(i, bar);
+    }
+}
+
+bool OveSerialize::readBar(int bar)
+{
+    int i;
+    int j;
+    int trackCount = m_ove->getTrackCount();
+    int trackBarCount = m_ove->getTrackBarCount();
+
+    for (i = 0; i < trackCount; ++i) {
+        m_ove->setMeasureData(i, bar, new MeasureData());
+    }
+
+    SizeChunk conductChunk;
+
+    if (!readBarChunk(m_condPositions[bar], Chunk::ConductName, &conductChunk)) {
+        return false;
+    }
+    if (!m_barsParse->parseConductChunk(bar, &conductChunk)) {
+        return false;
+    }
+
+    for (i = 0; i < trackCount; ++i) {
+        int index = i * trackBarCount + bar;
+        SizeChunk bdatChunk;
+
+        if (!readBarChunk(m_bdatPositions[index], Chunk::BdatName, &bdatChunk)) {
+            return false;
+        }
+        if (!m_barsParse->parseBdatChunk(index, &bdatChunk)) {
+            return false;
+        }
+    }
+
+    if (m_lyricParse != 0) {
+        m_lyricParse->processBar(bar);
+    }
+
+    m_organizer->organizeAttributes(bar);
+
+    // the bars must stay loaded up to the last one a cross measure element starting here or before ends in
+    int lastLinkedBar = bar > 0 ? m_lastLinkedBars[bar - 1] : bar;
+
+    for (i = 0; i < trackCount; ++i) {
+        QList<MusicData*> pairs = m_ove->getMeasureData(i, bar)->getCrossMeasureElements(
+            MusicDataType::None, MeasureData::PairType::Start);
+
+        for (j = 0; j < pairs.size(); ++j) {
+            lastLinkedBar = qMax(lastLinkedBar, qMin(bar + pairs[j]->stop()->getMeasure(), trackBarCount - 1));
+        }
+    }
+
+    m_lastLinkedBars.push_back(qMax(lastLinkedBar, bar));
+    ++m_readBarCount;
 
     return true;
 }
@@ -10463,17 +10627,17 @@ bool OveSerialize::readTracksData()
     unsigned short trackCount = trackGroupChunk.getCountBlock()->toCount();
 
     for (i = 0; i < trackCount; ++i) {
-        SizeChunk* trackChunk = new SizeChunk();
+        SizeChunk trackChunk;
 
         if (m_ove->getIsVersion4()) {
-            if (!readChunkName(trackChunk, Chunk::TrackName)) {
+            if (!readChunkName(&trackChunk, Chunk::TrackName)) {
                 return false;
             }
-            if (!readSizeChunk(trackChunk)) {
+            if (!readSizeChunk(&trackChunk)) {
                 return false;
             }
         } else {
-            if (!readDataChunk(trackChunk->getDataBlock(),
+            if (!readDataChunk(trackChunk.getDataBlock(),
                                SizeChunk::version3TrackSize)) {
                 return false;
             }
@@ -10481,7 +10645,7 @@ bool OveSerialize::readTracksData()
 
         TrackParse trackParse(m_ove);
 
-        trackParse.setTrack(trackChunk);
+        trackParse.setTrack(&trackChunk);
         trackParse.parse();
     }
 
@@ -10502,6 +10666,7 @@ bool OveSerialize::readPagesData()
 
     for (i = 0; i < pageCount; ++i) {
         SizeChunk* pageChunk = new SizeChunk();
+        parse.addPage(pageChunk);
 
         if (!readChunkName(pageChunk, Chunk::PageName)) {
             return false;
@@ -10509,8 +10674,6 @@ bool OveSerialize::readPagesData()
         if (!readSizeChunk(pageChunk)) {
             return false;
         }
-
-        parse.addPage(pageChunk);
     }
 
     if (!parse.parse()) {
@@ -10530,11 +10693,13 @@ bool OveSerialize::readLinesData()
     unsigned short lineCount = lineGroupChunk.getCountBlock()->toCount();
     int i;
     unsigned int j;
-    QList<SizeChunk*> lineChunks;
-    QList<SizeChunk*> staffChunks;
+    LineGroupParse parse(m_ove);
+
+    parse.setLineGroup(&lineGroupChunk);
 
     for (i = 0; i < lineCount; ++i) {
         SizeChunk* lineChunk = new SizeChunk();
+        parse.addLine(lineChunk);
 
         if (!readChunkName(lineChunk, Chunk::LineName)) {
             return false;
@@ -10543,13 +10708,12 @@ bool OveSerialize::readLinesData()
             return false;
         }
 
-        lineChunks.push_back(lineChunk);
-
         StaffCountGetter getter(m_ove);
         unsigned int staffCount = getter.getStaffCount(lineChunk);
 
         for (j = 0; j < staffCount; ++j) {
             SizeChunk* staffChunk = new SizeChunk();
+            parse.addStaff(staffChunk);
 
             if (!readChunkName(staffChunk, Chunk::StaffName)) {
                 return false;
@@ -10557,23 +10721,9 @@ bool OveSerialize::readLinesData()
             if (!readSizeChunk(staffChunk)) {
                 return false;
             }
-
-            staffChunks.push_back(staffChunk);
         }
     }
 
-    LineGroupParse parse(m_ove);
-
-    parse.setLineGroup(&lineGroupChunk);
-
-    for (i = 0; i < lineChunks.size(); ++i) {
-        parse.addLine(lineChunks[i]);
-    }
-
-    for (i = 0; i < staffChunks.size(); ++i) {
-        parse.addStaff(staffChunks[i]);
-    }
-
     if (!parse.parse()) {
         return false;
     }
@@ -10591,75 +10741,94 @@ bool OveSerialize::readBarsData()
     unsigned short measCount = barGroupChunk.getCountBlock()->toCount();
     int i;
 
-    QList<SizeChunk*> measureChunks;
-    QList<SizeChunk*> conductChunks;
-    QList<SizeChunk*> bdatChunks;
-
     m_ove->setTrackBarCount(measCount);
 
-    // read chunks
+    delete m_barsParse;
+    m_barsParse = new BarsParse(m_ove);
+    m_barsParse->setNotify(m_notify);
+
+    if (!m_barsParse->createMeasures(measCount)) {
+        return false;
+    }
+
+    // parse the chunks as they are read, each of them is released before the next one is read
     for (i = 0; i < measCount; ++i) {
-        SizeChunk* measureChunkPtr = new SizeChunk();
+        SizeChunk measureChunk;
 
-        if (!readChunkName(measureChunkPtr, Chunk::MeasureName)) {
+        if (!readChunkName(&measureChunk, Chunk::MeasureName)) {
             return false;
         }
-        if (!readSizeChunk(measureChunkPtr)) {
+        if (!readSizeChunk(&measureChunk)) {
+            return false;
+        }
+        if (!m_barsParse->parseMeasureChunk(i, &measureChunk)) {
             return false;
         }
-
-        measureChunks.push_back(measureChunkPtr);
     }
 
+    // the time signatures and bar numbers of all bars are needed before any bar is converted,
+    // the rest of the COND chunk is parsed again when its bar is loaded
+    m_condPositions.clear();
     for (i = 0; i < measCount; ++i) {
-        SizeChunk* conductChunkPtr = new SizeChunk();
+        SizeChunk conductChunk;
+
+        m_condPositions.push_back(m_streamHandle->pos());
 
-        if (!readChunkName(conductChunkPtr, Chunk::ConductName)) {
+        if (!readChunkName(&conductChunk, Chunk::ConductName)) {
             return false;
         }
-
-        if (!readSizeChunk(conductChunkPtr)) {
+        if (!readSizeChunk(&conductChunk)) {
             return false;
         }
 
-        conductChunks.push_back(conductChunkPtr);
+        m_ove->setMeasureData(0, i, new MeasureData());
+        bool parsed = m_barsParse->parseConductChunk(i, &conductChunk);
+        m_ove->releaseMeasureData(0, i);
+
+        if (!parsed) {
+            return false;
+        }
     }
 
+    // the note data is only located here, it is read by loadBar()
+    m_bdatPositions.clear();
     int bdatCount = m_ove->getTrackCount() * measCount;
     for (i = 0; i < bdatCount; ++i) {
-        SizeChunk* batChunkPtr = new SizeChunk();
-
-        if (!readChunkName(batChunkPtr, Chunk::BdatName)) {
+        if (!skipBarChunk(Chunk::BdatName, m_bdatPositions)) {
             return false;
         }
-        if (!readSizeChunk(batChunkPtr)) {
-            return false;
-        }
-
-        bdatChunks.push_back(batChunkPtr);
     }
 
-    // parse bars
-    BarsParse barsParse(m_ove);
+    return true;
+}
+
+bool OveSerialize::skipBarChunk(const QString& name, QList<qint64>& positions)
+{
+    SizeChunk sizeChunk;
+    SizeBlock* sizeBlock = sizeChunk.getSizeBlock();
 
-    for (i = 0; i < measureChunks.size(); ++i) {
-        barsParse.addMeasure(measureChunks[i]);
-    }
+    positions.push_back(m_streamHandle->pos());
 
-    for (i = 0; i < conductChunks.size(); ++i) {
-        barsParse.addConduct(conductChunks[i]);
+    if (!readChunkName(&sizeChunk, name)) {
+        return false;
     }
-
-    for (i = 0; i < bdatChunks.size(); ++i) {
-        barsParse.addBdat(bdatChunks[i]);
+    if (!m_streamHandle->read((char*)sizeBlock->data(), sizeBlock->size())) {
+        return false;
     }
 
-    barsParse.setNotify(m_notify);
-    if (!barsParse.parse()) {
+    return m_streamHandle->seek(m_streamHandle->pos() + sizeBlock->toSize());
+}
+
+bool OveSerialize::readBarChunk(qint64 position, const QString& name, SizeChunk* sizeChunk)
+{
+    if (m_streamHandle == 0 || !m_streamHandle->seek(position)) {
+        return false;
+    }
+    if (!readChunkName(sizeChunk, name)) {
         return false;
     }
 
-    return true;
+    return readSizeChunk(sizeChunk);
 }
 
 bool OveSerialize::readOveEnd()
@@ -25,6 +25,7 @@
 
 #include <QList>
 #include <QString>
+#include <QStringList>
 #include <cmath>
 
 #ifdef WIN32
@@ -33,6 +34,8 @@
 #define DLL_EXPORT
 #endif
 
+class QIODevice;
+
 namespace ovebase {
 class OveSong;
 class Track;
@@ -501,11 +504,21 @@ public:
 public:
     virtual void setNotify(IOveNotify* notify) = 0;
     virtual void setFileStream(unsigned char* buffer, unsigned int size) = 0;
+    virtual void setFileStream(QIODevice* device) = 0;
     virtual void setOve(OveSong* ove) = 0;
 
     // read stream, set read data to setOve(ove)
+    // the note data of the bars is not read here, it is read bar by bar with loadBar()
     virtual bool load() = 0;
 
+    // read and organize the note data of the bar in all tracks, the bars are loaded in order,
+    // the bars the cross measure elements of the bar end in are read as well
+    virtual bool loadBar(int bar) = 0;
+    // last bar that a cross measure element starting in this bar or before it ends in, the bar is loaded
+    virtual int getLastLinkedBar(int bar) const = 0;
+    // free the note data of the bar in all tracks
+    virtual void releaseBar(int bar) = 0;
+
     virtual void release() = 0;
 };
 
@@ -765,6 +778,9 @@ public:
     int getMeasureDataCount(void) const;
     MeasureData* getMeasureData(int part, int staff /* = 0 */, int bar) const;
     MeasureData* getMeasureData(int track, int bar) const;
+    // the measure data of a bar is null until the bar is loaded and after it is released
+    void setMeasureData(int track, int bar, MeasureData* ptr);
+    void releaseMeasureData(int track, int bar);
 
     // tool
     void setPartStaffCounts(const QList<int>& partStaffCounts);
@@ -2226,19 +2242,39 @@ public:
     StreamHandle(unsigned char* p, int size);
     virtual ~StreamHandle();
 
-private:
+protected:
     StreamHandle();
 
 public:
     virtual bool read(char* buff, int size);
     virtual bool write(char* buff, int size);
 
+    virtual qint64 pos() const;
+    virtual bool seek(qint64 pos);
+
 private:
     int m_size;
     int m_curPos;
     unsigned char* m_point;
 };
 
+// reads the file from the device as the chunks are read, the whole file is never in memory
+class DeviceStreamHandle : public StreamHandle
+{
+public:
+    explicit DeviceStreamHandle(QIODevice* device);
+    virtual ~DeviceStreamHandle() {}
+
+public:
+    virtual bool read(char* buff, int size);
+
+    virtual qint64 pos() const;
+    virtual bool seek(qint64 pos);
+
+private:
+    QIODevice* m_device;
+};
+
 // base block, or resizable block in ove to store data
 class Block
 {
@@ -2468,7 +2504,7 @@ public:
     virtual ~PageGroupParse();
 
 public:
-    void addPage(SizeChunk* chunk);
+    void addPage(SizeChunk* chunk); // takes ownership
 
     virtual bool parse();
 
@@ -2497,8 +2533,8 @@ public:
 
 public:
     void setLineGroup(GroupChunk* chunk);
-    void addLine(SizeChunk* chunk);
-    void addStaff(SizeChunk* chunk);
+    void addLine(SizeChunk* chunk); // takes ownership
+    void addStaff(SizeChunk* chunk); // takes ownership
 
     virtual bool parse();
 
@@ -2512,6 +2548,8 @@ private:
     QList<SizeChunk*> m_staffChunks;
 };
 
+// parses the chunks of the bars one by one as they are read, so only one of them is in memory at a time,
+// the MEAS and COND chunks come per measure, the BDAT chunks per track and measure
 class BarsParse : public BasicParse
 {
 public:
@@ -2519,11 +2557,12 @@ public:
     virtual ~BarsParse();
 
 public:
-    void addMeasure(SizeChunk* chunk);
-    void addConduct(SizeChunk* chunk);
-    void addBdat(SizeChunk* chunk);
+    bool createMeasures(int measureCount);
 
-    virtual bool parse();
+    bool parseMeasureChunk(int measureIndex, SizeChunk* chunk);
+    // the measure data of the bar must be set before its COND and BDAT chunks are parsed
+    bool parseConductChunk(int measureIndex, SizeChunk* chunk);
+    bool parseBdatChunk(int index, SizeChunk* chunk);
 
 private:
     bool parseMeas(Measure* measure, SizeChunk* chunk);
@@ -2575,11 +2614,6 @@ private:
     bool parseOffsetCommonBlock(MusicData* ptr);
     bool parsePairLinesBlock(PairEnds* ptr); // size == 2
     bool parseOffsetElement(OffsetElement* ptr); // size == 2
-
-private:
-    QList<SizeChunk*> m_measureChunks;
-    QList<SizeChunk*> m_conductChunks;
-    QList<SizeChunk*> m_bdatChunks;
 };
 
 class LyricChunkParse : public BasicParse
@@ -2593,6 +2627,9 @@ public:
 
     virtual bool parse();
 
+    // set the words of the lyrics to the bar, the bars of a track are processed in order
+    void processBar(int bar);
+
 private:
     struct LyricInfo {
         int m_track;
@@ -2606,17 +2643,20 @@ private:
         int m_font;
         int m_fontSize;
         int m_fontStyle;
+        QStringList m_words;
+        int m_wordIndex; // first word not set to a lyric yet
 
         LyricInfo()
             : m_track(0), m_measure(0), m_verse(0), m_voice(0), m_wordCount(0),
             m_lyricSize(0), m_name(QString()), m_lyric(QString()),
-            m_font(0), m_fontSize(12), m_fontStyle(0) {}
+            m_font(0), m_fontSize(12), m_fontStyle(0), m_wordIndex(0) {}
     };
 
-    void processLyricInfo(const LyricInfo& info);
+    void processLyricInfo(LyricInfo& info, int bar);
 
 private:
     SizeChunk* m_chunk;
+    QList<LyricInfo> m_lyricInfos;
 };
 
 class TitleChunkParse : public BasicParse
@@ -2654,10 +2694,13 @@ public:
 public:
     void organize();
 
+    // the bars are organized in order, the attributes of a bar as soon as it is read and
+    // its measures once the bars its cross measure elements end in are read
+    void organizeAttributes(int bar);
+    void organizeMeasures(int bar);
+
 private:
-    void organizeAttributes();
     void organizeTracks();
-    void organizeMeasures();
     void organizeMeasure(int part, int track, Measure* measure, MeasureData* measureData);
 
     void organizeContainers(int part, int track, Measure* measure, MeasureData* measureData);
@@ -2670,6 +2713,8 @@ private:
 
 private:
     OveSong* m_ove;
+    QList<int> m_lastKeys;
+    QList<ClefType> m_lastClefTypes;
 };
 
 class StreamHandle;
@@ -2688,9 +2733,14 @@ public:
 public:
     virtual void setOve(OveSong* ove);
     virtual void setFileStream(unsigned char* buffer, unsigned int size);
+    virtual void setFileStream(QIODevice* device);
     virtual void setNotify(IOveNotify* notify);
     virtual bool load(void);
 
+    virtual bool loadBar(int bar);
+    virtual int getLastLinkedBar(int bar) const;
+    virtual void releaseBar(int bar);
+
     virtual void release();
 
 private:
@@ -2706,6 +2756,9 @@ private:
     bool readPagesData();
     bool readLinesData();
     bool readBarsData();
+    bool skipBarChunk(const QString& name, QList<qint64>& positions);
+    bool readBarChunk(qint64 position, const QString& name, SizeChunk* sizeChunk);
+    bool readBar(int bar);
     bool readOveEnd();
 
     void messageOutError();
@@ -2715,6 +2768,17 @@ private:
     OveSong* m_ove;
     StreamHandle* m_streamHandle;
     IOveNotify* m_notify;
+
+    BarsParse* m_barsParse;
+    LyricChunkParse* m_lyricParse;
+    OveOrganizer* m_organizer;
+
+    // stream positions of the COND chunks by bar and of the BDAT chunks by track and bar
+    QList<qint64> m_condPositions;
+    QList<qint64> m_bdatPositions;
+    QList<int> m_lastLinkedBars;
+    int m_readBarCount;
+    int m_organizedBarCount;
 };
 }
 
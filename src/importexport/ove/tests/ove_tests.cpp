@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "io/file.h"
+
+#include "engraving/engravingerrors.h"
+#include "engraving/dom/chordrest.h"
+#include "engraving/dom/lyrics.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
+#include "engraving/dom/segment.h"
+#include "engraving/dom/spanner.h"
+
+#include "engraving/tests/utils/scorecomp.h"
+#include "engraving/tests/utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+extern engraving::Err importOve(MasterScore*, const QString& name);
+
+static const String OVE_DIR("data/");
+
+class Ove_Tests : public ::testing::Test
+{
+public:
+    MasterScore* readOve(const String& path, bool isAbsolutePath = false);
+    void checkBars(const char* file, size_t staffCount, size_t measureCount);
+    void oveReadTest(const char* file);
+};
+
+//---------------------------------------------------------
+//   readOve
+//   the file is read through a DeviceStreamHandle, the note data bar by bar while it is converted
+//---------------------------------------------------------
+
+MasterScore* Ove_Tests::readOve(const String& path, bool isAbsolutePath)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) -> engraving::Err {
+        return importOve(score, path.toQString());
+    };
+
+    return ScoreRW::readScore(path, isAbsolutePath, importFunc);
+}
+
+//---------------------------------------------------------
+//   checkBars
+//   every bar of every track must be loaded and converted
+//---------------------------------------------------------
+
+void Ove_Tests::checkBars(const char* file, size_t staffCount, size_t measureCount)
+{
+    MasterScore* score = readOve(OVE_DIR + String::fromUtf8(file) + u".ove");
+    ASSERT_TRUE(score);
+
+    EXPECT_EQ(score->nstaves(), staffCount);
+    EXPECT_EQ(score->nmeasures(), measureCount);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            bool hasChordRest = false;
+            for (Segment* s = m->first(SegmentType::ChordRest); s && !hasChordRest; s = s->next(SegmentType::ChordRest)) {
+                for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+                    hasChordRest = hasChordRest || s->element(staffIdx * VOICES + voice);
+                }
+            }
+            EXPECT_TRUE(hasChordRest) << "measure " << m->no() << ", staff " << staffIdx;
+        }
+    }
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   oveReadTest
+//   the whole conversion is compared with a reference written by the importer before it read the file bar by bar
+//---------------------------------------------------------
+
+void Ove_Tests::oveReadTest(const char* file)
+{
+    String fileName = String::fromUtf8(file) + u".ove";
+
+    MasterScore* score = readOve(OVE_DIR + fileName);
+    ASSERT_TRUE(score);
+    EXPECT_TRUE(ScoreComp::saveCompareScore(score, fileName + u".mscx", OVE_DIR + fileName + u"-ref.mscx"));
+
+    delete score;
+}
+
+//! NOTE The references (data/*.ove-ref.mscx) are to be written with the importer of the baseline
+//! commit, before the bar by bar loading, these tests are disabled until they are added
+TEST_F(Ove_Tests, DISABLED_oveBeamOverBarlineRef) {
+    oveReadTest("beam-over-barline");
+}
+
+TEST_F(Ove_Tests, DISABLED_oveLyricRef) {
+    oveReadTest("lyric");
+}
+
+TEST_F(Ove_Tests, DISABLED_ovePageRef) {
+    oveReadTest("page");
+}
+
+TEST_F(Ove_Tests, DISABLED_oveSlurRef) {
+    oveReadTest("slur");
+}
+
+TEST_F(Ove_Tests, oveBeamOverBarline) {
+    checkBars("beam-over-barline", 1, 4);
+}
+
+TEST_F(Ove_Tests, ovePage) {
+    checkBars("page", 3, 41);
+}
+
+TEST_F(Ove_Tests, oveSlur) {
+    checkBars("slur", 1, 6);
+
+    MasterScore* score = readOve(OVE_DIR + u"slur.ove");
+    ASSERT_TRUE(score);
+
+    // the slurs are converted once the bars they end in are loaded
+    size_t slurs = 0;
+    for (const auto& pair : score->spanner()) {
+        if (pair.second->isSlur()) {
+            ++slurs;
+        }
+    }
+    EXPECT_GT(slurs, 0u);
+
+    delete score;
+}
+
+TEST_F(Ove_Tests, oveLyrics) {
+    checkBars("lyric", 3, 3);
+
+    MasterScore* score = readOve(OVE_DIR + u"lyric.ove");
+    ASSERT_TRUE(score);
+
+    // the words of the LYRC chunk are set to the lyrics as their bars are loaded
+    bool found = false;
+    for (Segment* s = score->firstMeasure()->first(SegmentType::ChordRest); s && !found; s = s->next1(SegmentType::ChordRest)) {
+        ChordRest* cr = s->cr(0);
+        if (!cr) {
+            continue;
+        }
+        for (const Lyrics* lyrics : cr->lyrics()) {
+            found = found || lyrics->plainText() == u"word1";
+        }
+    }
+    EXPECT_TRUE(found);
+
+    delete score;
+}
+
+TEST_F(Ove_Tests, oveTruncated) {
+    ByteArray data;
+    ASSERT_TRUE(io::File::readFile(ScoreRW::rootPath() + u"/" + OVE_DIR + u"page.ove", data));
+
+    // the note data is cut off, the bars can't be loaded
+    String truncated(u"page-truncated.ove");
+    ASSERT_TRUE(io::File::writeFile(truncated, data.left(data.size() / 2)));
+
+    MasterScore* score = readOve(truncated, true);
+    EXPECT_FALSE(score);
+
+    io::File::remove(truncated);
+}
@@ -0,0 +1,239 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+
+#include "io/file.h"
+#include "serialization/json.h"
+#include "stringutils.h"
+
+#include "importcorpus.h"
+#include "importmetrics.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::iex;
+
+//! NOTE The benchmark is configured with environment variables:
+//! MU_IMPORT_BENCHMARK_REPEATS   - how many times each file is imported, the fastest run is reported (1)
+//! MU_IMPORT_BENCHMARK_OUTPUT    - where the results are written as JSON (import_benchmark.json)
+//! MU_IMPORT_BENCHMARK_BASELINE  - the results of an earlier run, a file that got slower
+//!                                 or allocates more than the tolerance allows fails the test
+//! MU_IMPORT_BENCHMARK_TOLERANCE - the allowed regression as a fraction (0.25)
+//! MU_IMPORT_BENCHMARK_FORMATS   - only the files with these suffixes are imported, separated by commas (all)
+
+static const double MIN_COMPARED_MS = 5.0; // faster imports are too noisy to be compared
+
+static std::string envValue(const char* name, const std::string& def)
+{
+    const char* value = std::getenv(name);
+    return (value && *value) ? std::string(value) : def;
+}
+
+static std::string relativePath(const io::path_t& path)
+{
+    const std::string root = IEX_IMPORT_CORPUS_ROOT;
+    std::string str = path.toStdString();
+    if (str.rfind(root, 0) == 0) {
+        str = str.substr(root.size());
+        if (!str.empty() && str.front() == '/') {
+            str = str.substr(1);
+        }
+    }
+    return str;
+}
+
+class ImportBenchmark_Tests : public ::testing::Test
+{
+public:
+    struct Measurement {
+        bool ok = false;
+        double ms = 0.0;
+        uint64_t allocations = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t peakRssKb = 0;
+    };
+
+    Measurement measure(const io::path_t& path, int repeats) const;
+    void compareWithBaseline(const JsonArray& files, const io::path_t& baselinePath, double tolerance) const;
+};
+
+//---------------------------------------------------------
+//   measure
+//---------------------------------------------------------
+
+ImportBenchmark_Tests::Measurement ImportBenchmark_Tests::measure(const io::path_t& path, int repeats) const
+{
+    Measurement m;
+    m.ok = true;
+
+    ImportMetrics::resetPeakRss();
+    const uint64_t allocations = ImportMetrics::allocations();
+    const uint64_t allocatedBytes = ImportMetrics::allocatedBytes();
+
+    for (int i = 0; i < repeats; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        Ret ret = ImportCorpus::importFile(path);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        m.ok = m.ok && ret.success();
+        m.ms = (i == 0) ? elapsed.count() : std::min(m.ms, elapsed.count());
+    }
+
+    m.allocations = (ImportMetrics::allocations() - allocations) / repeats;
+    m.allocatedBytes = (ImportMetrics::allocatedBytes() - allocatedBytes) / repeats;
+    m.peakRssKb = ImportMetrics::peakRssKb();
+
+    return m;
+}
+
+//---------------------------------------------------------
+//   compareWithBaseline
+//---------------------------------------------------------
+
+void ImportBenchmark_Tests::compareWithBaseline(const JsonArray& files, const io::path_t& baselinePath, double tolerance) const
+{
+    ByteArray data;
+    Ret ret = io::File::readFile(baselinePath, data);
+    ASSERT_TRUE(ret) << "failed to read the baseline: " << baselinePath.toStdString();
+
+    std::string err;
+    JsonDocument baseline = JsonDocument::fromJson(data, &err);
+    ASSERT_TRUE(err.empty()) << "failed to parse the baseline: " << err;
+
+    std::map<std::string, JsonObject> baselineFiles;
+    JsonArray baselineArray = baseline.rootObject().value("files").toArray();
+    for (size_t i = 0; i < baselineArray.size(); ++i) {
+        JsonObject file = baselineArray.at(i).toObject();
+        baselineFiles[file.value("path").toStdString()] = file;
+    }
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        JsonObject file = files.at(i).toObject();
+        const std::string path = file.value("path").toStdString();
+        auto it = baselineFiles.find(path);
+        if (it == baselineFiles.end()) {
+            continue;
+        }
+
+        const JsonObject& base = it->second;
+        EXPECT_TRUE(file.value("ok").toBool() || !base.value("ok").toBool()) << path << ": the import fails now";
+
+        const double allocations = file.value("allocations").toDouble();
+        const double baseAllocations = base.value("allocations").toDouble();
+        EXPECT_LE(allocations, baseAllocations * (1.0 + tolerance)) << path << ": allocations " << baseAllocations << " -> " << allocations;
+
+        const double ms = file.value("ms").toDouble();
+        const double baseMs = base.value("ms").toDouble();
+        if (baseMs >= MIN_COMPARED_MS) {
+            EXPECT_LE(ms, baseMs * (1.0 + tolerance)) << path << ": time " << baseMs << " ms -> " << ms << " ms";
+        }
+    }
+}
+
+/**
+ * @brief ImportBenchmark_Tests_importCorpus
+ * @details Imports every file of the corpus with the reader of its format
+ *          and reports the time, throughput, allocations and peak memory of each import
+ */
+TEST_F(ImportBenchmark_Tests, importCorpus)
+{
+    const int repeats = std::max(1, std::atoi(envValue("MU_IMPORT_BENCHMARK_REPEATS", "1").c_str()));
+    const io::path_t outputPath = envValue("MU_IMPORT_BENCHMARK_OUTPUT", "import_benchmark.json");
+    const std::string baselinePath = envValue("MU_IMPORT_BENCHMARK_BASELINE", "");
+    const double tolerance = std::atof(envValue("MU_IMPORT_BENCHMARK_TOLERANCE", "0.25").c_str());
+
+    std::vector<ImportCorpus::Entry> entries = ImportCorpus::scan(ImportCorpus::dirs());
+
+    const std::string formatsFilter = envValue("MU_IMPORT_BENCHMARK_FORMATS", "");
+    if (!formatsFilter.empty()) {
+        std::vector<std::string> suffixes;
+        strings::split(formatsFilter, suffixes, ",");
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&suffixes](const ImportCorpus::Entry& entry) {
+            return std::find(suffixes.begin(), suffixes.end(), entry.suffix) == suffixes.end();
+        }), entries.end());
+    }
+
+    ASSERT_FALSE(entries.empty());
+
+    JsonArray files;
+    std::map<std::string, JsonObject> formats;
+    uint64_t totalBytes = 0;
+    double totalMs = 0.0;
+
+    for (const ImportCorpus::Entry& entry : entries) {
+        Measurement m = measure(entry.path, repeats);
+
+        const double mbPerSec = m.ms > 0.0 ? (entry.size / (1024.0 * 1024.0)) / (m.ms / 1000.0) : 0.0;
+
+        JsonObject file;
+        file.set("path", relativePath(entry.path));
+        file.set("suffix", entry.suffix);
+        file.set("ok", m.ok);
+        file.set("bytes", static_cast<double>(entry.size));
+        file.set("ms", m.ms);
+        file.set("mbPerSec", mbPerSec);
+        file.set("allocations", static_cast<double>(m.allocations));
+        file.set("allocatedBytes", static_cast<double>(m.allocatedBytes));
+        file.set("peakRssKb", static_cast<double>(m.peakRssKb));
+        files.append(file);
+
+        JsonObject& format = formats[entry.suffix];
+        format.set("files", format.value("files").toInt() + 1);
+        format.set("bytes", format.value("bytes").toDouble() + entry.size);
+        format.set("ms", format.value("ms").toDouble() + m.ms);
+        format.set("allocations", format.value("allocations").toDouble() + m.allocations);
+        format.set("peakRssKb", std::max(format.value("peakRssKb").toDouble(), static_cast<double>(m.peakRssKb)));
+
+        totalBytes += entry.size;
+        totalMs += m.ms;
+
+        LOGI() << relativePath(entry.path) << ": " << m.ms << " ms, " << mbPerSec << " MB/s, "
+               << m.allocations << " allocations, peak RSS " << m.peakRssKb << " KB" << (m.ok ? "" : ", FAILED");
+    }
+
+    JsonObject summary;
+    for (auto& p : formats) {
+        const double ms = p.second.value("ms").toDouble();
+        p.second.set("mbPerSec", ms > 0.0 ? (p.second.value("bytes").toDouble() / (1024.0 * 1024.0)) / (ms / 1000.0) : 0.0);
+        summary.set(p.first, p.second);
+    }
+
+    JsonObject root;
+    root.set("repeats", repeats);
+    root.set("totalBytes", static_cast<double>(totalBytes));
+    root.set("totalMs", totalMs);
+    root.set("formats", summary);
+    root.set("files", files);
+
+    Ret ret = io::File::writeFile(outputPath, JsonDocument(root).toJson());
+    EXPECT_TRUE(ret) << "failed to write the results: " << outputPath.toStdString();
+
+    if (!baselinePath.empty()) {
+        compareWithBaseline(files, baselinePath, tolerance);
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "importcorpus.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+
+#include "io/dir.h"
+#include "stringutils.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+
+#include "importexport/bb/internal/notationbbreader.h"
+#include "importexport/bww/internal/notationbwwreader.h"
+#include "importexport/capella/internal/capellareader.h"
+#include "importexport/guitarpro/internal/guitarproreader.h"
+#include "importexport/mei/internal/meireader.h"
+#include "importexport/midi/internal/notationmidireader.h"
+#include "importexport/musedata/internal/musedatareader.h"
+#include "importexport/musicxml/internal/musicxmlreader.h"
+#include "importexport/ove/internal/overeader.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::iex;
+using namespace mu::engraving;
+
+//! NOTE The same suffixes as the modules register their readers for
+static const std::map<std::string, project::INotationReaderPtr>& readers()
+{
+    static const std::map<std::string, project::INotationReaderPtr> s_readers = [] {
+        std::map<std::string, project::INotationReaderPtr> readers;
+        auto reg = [&readers](const std::vector<std::string>& suffixes, project::INotationReaderPtr reader) {
+            for (const std::string& suffix : suffixes) {
+                readers[suffix] = reader;
+            }
+        };
+
+        reg({ "mgu", "sgu" }, std::make_shared<bb::NotationBBReader>());
+        reg({ "bmw", "bww" }, std::make_shared<bww::NotationBwwReader>());
+        reg({ "cap", "capx" }, std::make_shared<capella::CapellaReader>());
+        reg({ "gtp", "gp3", "gp4", "gp5", "gpx", "gp", "ptb" }, std::make_shared<guitarpro::GuitarProReader>());
+        reg({ "mei" }, std::make_shared<mei::MeiReader>());
+        reg({ "mid", "midi", "kar" }, std::make_shared<midi::NotationMidiReader>());
+        reg({ "md" }, std::make_shared<musedata::MuseDataReader>());
+        reg({ "xml", "musicxml", "mxl" }, std::make_shared<musicxml::MusicXmlReader>());
+        reg({ "ove", "scw" }, std::make_shared<ove::OveReader>());
+
+        return readers;
+    }();
+
+    return s_readers;
+}
+
+std::vector<std::string> ImportCorpus::suffixes()
+{
+    std::vector<std::string> result;
+    for (const auto& p : readers()) {
+        result.push_back(p.first);
+    }
+    return result;
+}
+
+project::INotationReaderPtr ImportCorpus::reader(const std::string& suffix)
+{
+    auto it = readers().find(suffix);
+    return it != readers().end() ? it->second : nullptr;
+}
+
+io::paths_t ImportCorpus::dirs()
+{
+    const path_t root = path_t(IEX_IMPORT_CORPUS_ROOT);
+    io::paths_t result = {
+        root + "/src/importexport/bb/tests/data",
+        root + "/src/importexport/bww/tests/data",
+        root + "/src/importexport/capella/tests/data",
+        root + "/src/importexport/guitarpro/tests/data",
+        root + "/src/importexport/mei/tests/data",
+        root + "/src/importexport/midi/tests/midiimport_data",
+        root + "/src/importexport/musicxml/tests/data",
+        root + "/src/importexport/ove/tests/data",
+        root + "/test/md",
+    };
+
+    const char* extraDirs = std::getenv("MU_IMPORT_CORPUS");
+    if (extraDirs) {
+#ifdef Q_OS_WIN
+        const char separator = ';';
+#else
+        const char separator = ':';
+#endif
+        std::vector<std::string> extra;
+        strings::split(extraDirs, extra, std::string(1, separator));
+        for (const std::string& dir : extra) {
+            if (!dir.empty()) {
+                result.push_back(path_t(dir));
+            }
+        }
+    }
+
+    return result;
+}
+
+std::vector<ImportCorpus::Entry> ImportCorpus::scan(const io::paths_t& dirs)
+{
+    std::vector<std::string> filters;
+    for (const std::string& suffix : suffixes()) {
+        filters.push_back("*." + suffix);
+    }
+
+    std::vector<Entry> entries;
+    for (const path_t& dir : dirs) {
+        RetVal<io::paths_t> files = Dir::scanFiles(dir, filters);
+        if (!files.ret) {
+            LOGW() << "failed to scan the corpus directory: " << dir << ", err: " << files.ret.toString();
+            continue;
+        }
+
+        for (const path_t& file : files.val) {
+            std::string suffix = io::suffix(file);
+            if (!reader(suffix)) {
+                continue;
+            }
+            entries.push_back({ file, suffix, fileSystem()->fileSize(file).val });
+        }
+    }
+
+    //! NOTE The order does not depend on the file system, so runs can be compared
+    std::sort(entries.begin(), entries.end(), [](const Entry& e1, const Entry& e2) {
+        return e1.path < e2.path;
+    });
+
+    return entries;
+}
+
+Ret ImportCorpus::importFile(const io::path_t& path)
+{
+    project::INotationReaderPtr r = reader(io::suffix(path));
+    if (!r) {
+        return make_ret(Ret::Code::NotSupported);
+    }
+
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+    Ret ret = r->read(score, path);
+
+    delete score;
+    return ret;
+}
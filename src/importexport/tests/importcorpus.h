@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IMPORTEXPORT_IMPORTCORPUS_H
+#define MU_IMPORTEXPORT_IMPORTCORPUS_H
+
+#include <string>
+#include <vector>
+
+#include "types/ret.h"
+#include "io/path.h"
+#include "io/ifilesystem.h"
+#include "modularity/ioc.h"
+
+#include "project/inotationreader.h"
+
+namespace mu::iex {
+//---------------------------------------------------------
+//   ImportCorpus
+//---------------------------------------------------------
+
+/**
+ The files the benchmark and the fuzzer feed to the readers of the importexport modules.
+ By default these are the test data of the modules and the MuseData samples in test/md,
+ more directories can be given in MU_IMPORT_CORPUS, separated like PATH.
+ There is no Power Tab (ptb) sample in the tree, give one in MU_IMPORT_CORPUS to cover that reader.
+ */
+
+class ImportCorpus
+{
+    INJECT_STATIC(io::IFileSystem, fileSystem)
+
+public:
+    struct Entry {
+        io::path_t path;
+        std::string suffix;
+        uint64_t size = 0;
+    };
+
+    static std::vector<std::string> suffixes();
+    static project::INotationReaderPtr reader(const std::string& suffix);
+
+    static io::paths_t dirs();
+    static std::vector<Entry> scan(const io::paths_t& dirs);
+
+    static Ret importFile(const io::path_t& path);
+};
+}
+
+#endif // MU_IMPORTEXPORT_IMPORTCORPUS_H
@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <cstdint>
+#include <cstdlib>
+
+#include <QDir>
+#include <QGuiApplication>
+
+#include "global/runtime.h"
+#include "io/file.h"
+#include "testing/environment.h"
+
+#include "importcorpus.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::iex;
+
+//! NOTE A libFuzzer target for one reader, the format is set with MU_IMPORT_FUZZER_SUFFIX,
+//! the test data of the format serves as the seed corpus, for example:
+//! MU_IMPORT_FUZZER_SUFFIX=gp5 iex_import_fuzzer -timeout=10 new_corpus src/importexport/guitarpro/tests/data
+//! Inputs slower than the timeout are reported like crashes, so slow paths of the readers are caught too
+
+static std::string s_suffix;
+static io::path_t s_inputPath;
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv)
+{
+    static QGuiApplication app(*argc, *argv);
+
+    runtime::mainThreadId(); //! NOTE Needs only call
+    runtime::setThreadName("main");
+
+    testing::Environment::setup();
+
+    const char* suffix = std::getenv("MU_IMPORT_FUZZER_SUFFIX");
+    s_suffix = (suffix && *suffix) ? suffix : "xml";
+    if (!ImportCorpus::reader(s_suffix)) {
+        LOGE() << "no reader for the suffix: " << s_suffix;
+        std::abort();
+    }
+
+    //! NOTE The readers read files, so every input is written to the same file
+    s_inputPath = QDir::tempPath() + "/iex_import_fuzzer_" + QString::number(QCoreApplication::applicationPid()) + "."
+                  + QString::fromStdString(s_suffix);
+
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    Ret ret = io::File::writeFile(s_inputPath, ByteArray::fromRawData(data, size));
+    if (!ret) {
+        LOGE() << "failed to write the input: " << s_inputPath;
+        std::abort();
+    }
+
+    ImportCorpus::importFile(s_inputPath);
+
+    return 0;
+}
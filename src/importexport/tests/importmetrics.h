@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IMPORTEXPORT_IMPORTMETRICS_H
+#define MU_IMPORTEXPORT_IMPORTMETRICS_H
+
+#include <cstdint>
+
+namespace mu::iex {
+//---------------------------------------------------------
+//   ImportMetrics
+//---------------------------------------------------------
+
+/**
+ Process wide counters for the import benchmark.
+ The allocations are counted by the replaced global operator new,
+ so they are only available in the executable this file is linked to.
+ */
+
+class ImportMetrics
+{
+public:
+    static uint64_t allocations();
+    static uint64_t allocatedBytes();
+
+    //! NOTE Resetting the peak is only supported on Linux,
+    //! elsewhere the peak of the whole process is reported
+    static void resetPeakRss();
+    static uint64_t peakRssKb();
+};
+}
+
+#endif // MU_IMPORTEXPORT_IMPORTMETRICS_H
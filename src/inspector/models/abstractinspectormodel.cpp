@@ -24,6 +24,7 @@
 
 #include "types/texttypes.h"
 
+#include "dom/score.h"
 #include "dom/tempotext.h"
 
 #include "log.h"
@@ -349,8 +350,16 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
         return;
     }
 
+    IF_ASSERT_FAILED(items.front()) {
+        return;
+    }
+
     beginCommand();
 
+    // all items and their linked copies share the undo stack of the master score
+    mu::engraving::Score* score = items.front()->score();
+    score->startPropertyBatch();
+
     for (mu::engraving::EngravingItem* item : items) {
         IF_ASSERT_FAILED(item) {
             continue;
@@ -366,6 +375,8 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
         item->undoChangeProperty(pid, propValue, ps);
     }
 
+    score->endPropertyBatch();
+
     updateNotation();
     endCommand();
 }
@@ -146,6 +146,9 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool isCanvasTileCacheEnabled() const = 0;
+    virtual void setIsCanvasTileCacheEnabled(bool enabled) = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
 
@@ -158,6 +161,9 @@ public:
     virtual int notePlayDurationMilliseconds() const = 0;
     virtual void setNotePlayDurationMilliseconds(int durationMs) = 0;
 
+    virtual int undoMemoryBudgetMegabytes() const = 0;
+    virtual void setUndoMemoryBudgetMegabytes(int megabytes) = 0;
+
     virtual void setTemplateModeEnabled(std::optional<bool> enabled) = 0;
     virtual void setTestModeEnabled(std::optional<bool> enabled) = 0;
 
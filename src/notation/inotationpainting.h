@@ -46,6 +46,12 @@ public:
     virtual SizeF pageSizeInch(const Options& opt) const = 0;
 
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE Paints only the score content of one page (page sheet and items),
+    //! without the interaction overlays (selection, edit grips, drop guides, etc.)
+    virtual void paintViewPage(draw::Painter* painter, size_t pageIndex, const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewOverlay(draw::Painter* painter) = 0;
+
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
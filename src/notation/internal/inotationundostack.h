@@ -53,6 +53,9 @@ public:
 
     virtual bool isStackClean() const = 0;
 
+    //! Estimated memory retained by the undo history, in bytes
+    virtual size_t memoryUsage() const = 0;
+
     virtual void lock() = 0;
     virtual void unlock() = 0;
     virtual bool isLocked() const = 0;
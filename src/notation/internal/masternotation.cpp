@@ -492,11 +492,19 @@ void MasterNotation::unloadExcerpts(ExcerptNotationList& excerpts)
 
 void MasterNotation::initExcerpts(const ExcerptNotationList& excerpts)
 {
+    TRACEFUNC;
+
+    std::vector<mu::engraving::Excerpt*> engravingExcerpts;
+    engravingExcerpts.reserve(excerpts.size());
+
     for (IExcerptNotationPtr excerptNotation : excerpts) {
-        ExcerptNotation* impl = get_impl(excerptNotation);
+        engravingExcerpts.push_back(get_impl(excerptNotation)->excerpt());
+    }
+
+    masterScore()->initExcerpts(engravingExcerpts);
 
-        masterScore()->initExcerpt(impl->excerpt());
-        impl->init();
+    for (IExcerptNotationPtr excerptNotation : excerpts) {
+        get_impl(excerptNotation)->init();
     }
 }
 
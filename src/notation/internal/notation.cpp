@@ -24,7 +24,10 @@
 #include <QGuiApplication>
 #include <QScreen>
 
+#include "async/async.h"
+
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/undo.h"
 
 #include "notationpainting.h"
 #include "notationviewstate.h"
@@ -43,6 +46,9 @@
 using namespace mu::notation;
 using namespace mu::engraving;
 
+//! NOTE The number of pages laid out at once, when the layout of a large score continues after it is opened
+static constexpr size_t LAYOUT_CONTINUATION_PAGE_COUNT = 4;
+
 Notation::Notation(mu::engraving::Score* score)
 {
     m_painting = std::make_shared<NotationPainting>(this);
@@ -87,6 +93,11 @@ Notation::Notation(mu::engraving::Score* score)
         notifyAboutNotationChanged();
     });
 
+    //! NOTE Including the changes made by the continued layout itself
+    m_notationChanged.onNotify(this, [this]() {
+        scheduleLayoutContinuation();
+    });
+
     configuration()->canvasOrientation().ch.onReceive(this, [this](framework::Orientation) {
         if (m_score && m_score->autoLayoutEnabled()) {
             m_score->doLayout();
@@ -128,6 +139,30 @@ void Notation::setScore(Score* score)
 
     m_score = score;
     m_scoreInited.notify();
+
+    scheduleLayoutContinuation();
+}
+
+void Notation::scheduleLayoutContinuation()
+{
+    if (m_isLayoutContinuationScheduled || !m_score || !m_score->isLayoutPending()) {
+        return;
+    }
+
+    //! NOTE The remaining pages are laid out a few at a time from the event loop,
+    //! so the pages laid out so far can be painted and edited meanwhile
+    m_isLayoutContinuationScheduled = true;
+    async::Async::call(this, [this]() {
+        m_isLayoutContinuationScheduled = false;
+
+        //! NOTE The layout at the end of the command completes the pending one
+        if (!m_score || !m_score->isLayoutPending() || m_score->undoStack()->active()) {
+            return;
+        }
+
+        m_score->continueLayout(LAYOUT_CONTINUATION_PAGE_COUNT);
+        notifyAboutNotationChanged();
+    });
 }
 
 mu::async::Notification Notation::scoreInited() const
@@ -84,6 +84,7 @@ protected:
     async::Notification scoreInited() const override;
 
     void notifyAboutNotationChanged();
+    void scheduleLayoutContinuation();
 
     INotationPartsPtr m_parts = nullptr;
     INotationUndoStackPtr m_undoStack = nullptr;
@@ -97,6 +98,7 @@ private:
     async::Notification m_scoreInited;
 
     async::Notification m_openChanged;
+    bool m_isLayoutContinuationScheduled = false;
 
     INotationPaintingPtr m_painting = nullptr;
     INotationViewStatePtr m_viewState = nullptr;
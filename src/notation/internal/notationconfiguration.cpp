@@ -69,11 +69,13 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
+static const Settings::Key IS_CANVAS_TILE_CACHE_ENABLED_KEY(module_name, "ui/canvas/tileCacheEnabled");
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key WARN_GUITAR_BENDS(module_name, "score/note/warnGuitarBends");
 static const Settings::Key REALTIME_DELAY(module_name, "io/midi/realtimeDelay");
 static const Settings::Key NOTE_DEFAULT_PLAY_DURATION(module_name, "score/note/defaultPlayDuration");
+static const Settings::Key UNDO_MEMORY_BUDGET(module_name, "application/undo/memoryBudgetMB");
 
 static const Settings::Key FIRST_SCORE_ORDER_LIST_KEY(module_name, "application/paths/scoreOrderList1");
 static const Settings::Key SECOND_SCORE_ORDER_LIST_KEY(module_name, "application/paths/scoreOrderList2");
@@ -189,6 +191,8 @@ void NotationConfiguration::init()
     settings()->setDefaultValue(WARN_GUITAR_BENDS, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
     settings()->setDefaultValue(NOTE_DEFAULT_PLAY_DURATION, Val(500));
+    settings()->setDefaultValue(UNDO_MEMORY_BUDGET, Val(512)); // 0 = unlimited
+    settings()->setDefaultValue(IS_CANVAS_TILE_CACHE_ENABLED_KEY, Val(true));
 
     settings()->setDefaultValue(FIRST_SCORE_ORDER_LIST_KEY,
                                 Val(globalConfiguration()->appDataPath().toStdString() + "instruments/orders.xml"));
@@ -221,6 +225,7 @@ void NotationConfiguration::init()
     mu::engraving::MScore::warnPitchRange = colorNotesOutsideOfUsablePitchRange();
     mu::engraving::MScore::warnGuitarBends = warnGuitarBends();
     mu::engraving::MScore::defaultPlayDuration = notePlayDurationMilliseconds();
+    mu::engraving::MScore::undoMemoryBudget = static_cast<size_t>(undoMemoryBudgetMegabytes()) * 1024 * 1024;
 
     mu::engraving::MScore::setHRaster(DEFAULT_GRID_SIZE_SPATIUM);
     mu::engraving::MScore::setVRaster(DEFAULT_GRID_SIZE_SPATIUM);
@@ -654,6 +659,16 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::isCanvasTileCacheEnabled() const
+{
+    return settings()->value(IS_CANVAS_TILE_CACHE_ENABLED_KEY).toBool();
+}
+
+void NotationConfiguration::setIsCanvasTileCacheEnabled(bool enabled)
+{
+    settings()->setSharedValue(IS_CANVAS_TILE_CACHE_ENABLED_KEY, Val(enabled));
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
@@ -697,6 +712,17 @@ void NotationConfiguration::setNotePlayDurationMilliseconds(int durationMs)
     settings()->setSharedValue(NOTE_DEFAULT_PLAY_DURATION, Val(durationMs));
 }
 
+int NotationConfiguration::undoMemoryBudgetMegabytes() const
+{
+    return std::max(settings()->value(UNDO_MEMORY_BUDGET).toInt(), 0);
+}
+
+void NotationConfiguration::setUndoMemoryBudgetMegabytes(int megabytes)
+{
+    mu::engraving::MScore::undoMemoryBudget = static_cast<size_t>(std::max(megabytes, 0)) * 1024 * 1024;
+    settings()->setSharedValue(UNDO_MEMORY_BUDGET, Val(megabytes));
+}
+
 void NotationConfiguration::setTemplateModeEnabled(std::optional<bool> enabled)
 {
     mu::engraving::MScore::saveTemplateMode = enabled ? enabled.value() : false;
@@ -149,6 +149,9 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isCanvasTileCacheEnabled() const override;
+    void setIsCanvasTileCacheEnabled(bool enabled) override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
 
@@ -161,6 +164,9 @@ public:
     int notePlayDurationMilliseconds() const override;
     void setNotePlayDurationMilliseconds(int durationMs) override;
 
+    int undoMemoryBudgetMegabytes() const override;
+    void setUndoMemoryBudgetMegabytes(int megabytes) override;
+
     void setTemplateModeEnabled(std::optional<bool> enabled) override;
     void setTestModeEnabled(std::optional<bool> enabled) override;
 
@@ -124,10 +124,6 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
     };
 
     scoreRenderer()->paintScore(painter, score(), myopt);
-
-    if (!myopt.isPrinting) {
-        static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
-    }
 }
 
 void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const RectF& pageRect, bool printPageBackground) const
@@ -186,7 +182,31 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
+    opt.displayListCache = isPrinting ? nullptr : &m_viewDisplayLists;
     doPaint(painter, opt);
+
+    if (!isPrinting) {
+        paintViewOverlay(painter);
+    }
+}
+
+void NotationPainting::paintViewPage(Painter* painter, size_t pageIndex, const RectF& frameRect, bool isPrinting)
+{
+    Options opt;
+    opt.isSetViewport = false;
+    opt.isMultiPage = true;
+    opt.fromPage = static_cast<int>(pageIndex);
+    opt.toPage = static_cast<int>(pageIndex);
+    opt.frameRect = frameRect;
+    opt.deviceDpi = uiConfiguration()->logicalDpi();
+    opt.isPrinting = isPrinting;
+    opt.displayListCache = isPrinting ? nullptr : &m_viewDisplayLists;
+    doPaint(painter, opt);
+}
+
+void NotationPainting::paintViewOverlay(Painter* painter)
+{
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
 }
 
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
@@ -28,6 +28,7 @@
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
 #include "engraving/rendering/iscorerenderer.h"
+#include "engraving/rendering/displaylistcache.h"
 #include "ui/iuiconfiguration.h"
 
 namespace mu::engraving {
@@ -56,6 +57,8 @@ public:
     SizeF pageSizeInch(const Options& opt) const override;
 
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewPage(draw::Painter* painter, size_t pageIndex, const RectF& frameRect, bool isPrinting) override;
+    void paintViewOverlay(draw::Painter* painter) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
@@ -70,6 +73,9 @@ private:
 
     Notation* m_notation = nullptr;
 
+    //! NOTE Only the view replays display lists, the exports paint every item once
+    engraving::rendering::DisplayListCache m_viewDisplayLists;
+
     async::Notification m_viewModeChanged;
 };
 }
@@ -139,6 +139,15 @@ bool NotationUndoStack::isStackClean() const
     return undoStack()->isClean();
 }
 
+size_t NotationUndoStack::memoryUsage() const
+{
+    IF_ASSERT_FAILED(undoStack()) {
+        return 0;
+    }
+
+    return undoStack()->memoryUsage();
+}
+
 void NotationUndoStack::lock()
 {
     IF_ASSERT_FAILED(undoStack()) {
@@ -53,6 +53,8 @@ public:
 
     bool isStackClean() const override;
 
+    size_t memoryUsage() const override;
+
     void lock() override;
     void unlock() override;
     bool isLocked() const override;
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QImage>
+#include <QPainter>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/page.h"
+
+#include "engraving/tests/utils/scorerw.h"
+
+#include "notation/view/notationtilecache.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::notation;
+
+static const String TILECACHE_DATA_DIR("data/");
+
+class Notation_TileCacheTests : public ::testing::Test
+{
+public:
+    //! NOTE Paints the first page into a fresh image, every tile is filled with the current color
+    QColor paintFirstPage(NotationTileCache& cache, const MasterScore* score, bool isPrinting = false)
+    {
+        QImage image(256, 256, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+
+        {
+            QPainter qp(&image);
+            draw::Transform matrix;
+            matrix.scale(0.05, 0.05);
+
+            PageList pages = { score->pages().front() };
+            cache.paint(&qp, RectF(0, 0, image.width(), image.height()), pages, matrix, isPrinting,
+                        [this](draw::Painter* painter, size_t, const RectF& frameRect) {
+                ++m_renderedTiles;
+                painter->fillRect(frameRect, m_color);
+            });
+        }
+
+        return image.pixelColor(10, 10);
+    }
+
+    draw::Color m_color = draw::Color::BLACK;
+    size_t m_renderedTiles = 0;
+};
+
+//---------------------------------------------------------
+///  editThenRepaint
+///   a notification about a change of the notation makes the
+///   next repaint render the tiles again instead of blitting stale ones
+//---------------------------------------------------------
+
+TEST_F(Notation_TileCacheTests, editThenRepaint)
+{
+    MasterScore* score = ScoreRW::readScore(TILECACHE_DATA_DIR + u"tilecache.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    NotationTileCache cache;
+
+    m_color = draw::Color::RED;
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::red));
+    EXPECT_EQ(m_renderedTiles, 1u);
+
+    // panning only blits the cached tile
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::red));
+    EXPECT_EQ(m_renderedTiles, 1u);
+
+    // an undoable edit: the changes range comes right before the notification
+    m_color = draw::Color::BLUE;
+    cache.onChangesRange(0);
+    cache.onNotationChanged();
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::blue));
+    EXPECT_EQ(m_renderedTiles, 2u);
+
+    // any other change of the notation, e.g. the score inversion or a selection color
+    m_color = draw::Color::GREEN;
+    cache.onNotationChanged();
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::green));
+    EXPECT_EQ(m_renderedTiles, 3u);
+
+    // a changes range does not cover the notifications which come after its own one
+    m_color = draw::Color::RED;
+    cache.onChangesRange(1);
+    cache.onNotationChanged();
+    cache.onNotationChanged();
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::red));
+    EXPECT_EQ(m_renderedTiles, 4u);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  changesRangeKeepsPreviousPages
+///   the tiles of the pages before the changes range stay cached
+//---------------------------------------------------------
+
+TEST_F(Notation_TileCacheTests, changesRangeKeepsPreviousPages)
+{
+    MasterScore* score = ScoreRW::readScore(TILECACHE_DATA_DIR + u"tilecache.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    NotationTileCache cache;
+
+    m_color = draw::Color::RED;
+    paintFirstPage(cache, score);
+    EXPECT_EQ(m_renderedTiles, 1u);
+
+    m_color = draw::Color::BLUE;
+    cache.onChangesRange(1);
+    cache.onNotationChanged();
+    EXPECT_EQ(paintFirstPage(cache, score), QColor(Qt::red));
+    EXPECT_EQ(m_renderedTiles, 1u);
+
+    delete score;
+}
@@ -25,6 +25,12 @@
 
 #include "actions/actiontypes.h"
 
+#include "engraving/dom/measure.h"
+#include "engraving/dom/page.h"
+#include "engraving/dom/score.h"
+#include "engraving/dom/spanner.h"
+#include "engraving/dom/system.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -239,7 +245,19 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
         m_shadowNoteRect = RectF();
+
+        m_tileCache.onNotationChanged();
+        invalidateTilesOfSelection();
+
         scheduleRedraw();
+
+        //! NOTE The content may have grown, e.g. with the pages laid out in the background
+        emit horizontalScrollChanged();
+        emit verticalScrollChanged();
+    });
+
+    m_notation->undoStack()->changesChannel().onReceive(this, [this](const ChangesRange& range) {
+        invalidateTiles(range);
     });
 
     onNoteInputStateChanged();
@@ -248,6 +266,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->selectionChanged().onNotify(this, [this]() {
+        invalidateTilesOfSelection();
         scheduleRedraw();
     });
 
@@ -262,17 +281,26 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->dropChanged().onNotify(this, [this]() {
+        //! NOTE Comes instead of the notation change after a drop
+        m_tileCache.onNotationChanged();
+
         if (!hasActiveFocus()) {
             forceFocusIn(); // grab keyboard focus after element added from palette
         }
     });
 
+    //! NOTE The drop target is highlighted while an item is dragged from a palette
+    interaction->dragChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
+    });
+
     updateLoopMarkers();
     notationPlayback()->loopBoundariesChanged().onNotify(this, [this]() {
         updateLoopMarkers();
     });
 
     m_notation->viewModeChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
         updateLoopMarkers();
     });
 
@@ -310,9 +338,15 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
 {
     m_notation->notationChanged().resetOnNotify(this);
+    m_notation->undoStack()->changesChannel().resetOnReceive(this);
     INotationInteractionPtr interaction = m_notation->interaction();
     interaction->noteInput()->stateChanged().resetOnNotify(this);
     interaction->selectionChanged().resetOnNotify(this);
+    interaction->dropChanged().resetOnNotify(this);
+    interaction->dragChanged().resetOnNotify(this);
+
+    m_tileCache.invalidate();
+    m_selectionRects.clear();
 
     if (isMainView()) {
         m_notation->accessibility()->setMapToScreenFunc(nullptr);
@@ -579,10 +613,27 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
-
+    Transform matrix = m_matrix * guiScalingCompensation;
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    if (isTileCacheUsed()) {
+        m_tileCache.paint(qp, rect, notationElements()->pages(), matrix, isPrinting,
+                          [this, isPrinting](draw::Painter* tilePainter, size_t pageIndex, const RectF& frameRect) {
+            notation()->painting()->paintViewPage(tilePainter, pageIndex, frameRect, isPrinting);
+        });
+
+        painter->setWorldTransform(matrix);
+
+        if (!isPrinting) {
+            notation()->painting()->paintViewOverlay(painter);
+        }
+    } else {
+        //! NOTE The score may be changed while it is painted directly
+        m_tileCache.invalidate();
+
+        painter->setWorldTransform(matrix);
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -618,14 +669,27 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
         scheduleRedraw();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
         scheduleRedraw();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
+        scheduleRedraw();
+    });
+
+    engravingConfiguration()->scoreInversionChanged().onNotify(this, [this]() {
+        m_tileCache.invalidate();
+        scheduleRedraw();
+    });
+
+    engravingConfiguration()->selectionColorChanged().onReceive(this, [this](int, const draw::Color&) {
+        m_tileCache.invalidate();
         scheduleRedraw();
     });
 }
@@ -643,6 +707,83 @@ void AbstractNotationPaintView::paintBackground(const RectF& rect, draw::Painter
     }
 }
 
+bool AbstractNotationPaintView::isTileCacheUsed() const
+{
+    if (!configuration()->isCanvasTileCacheEnabled()) {
+        return false;
+    }
+
+    //! NOTE While dragging or editing text, the score changes on every frame
+    INotationInteractionPtr interaction = notationInteraction();
+    return !interaction->isDragStarted() && !interaction->isTextEditingStarted();
+}
+
+void AbstractNotationPaintView::invalidateTiles(const ChangesRange& range)
+{
+    const mu::engraving::Score* score = notationElements()->msScore();
+    if (!score || !range.isValidBoundary() || !range.changedStyleIdSet.empty()) {
+        m_tileCache.invalidate();
+        return;
+    }
+
+    int tick = range.tickFrom;
+    for (const EngravingItem* item : range.changedItems) {
+        if (item->isSpanner()) {
+            tick = std::min(tick, mu::engraving::toSpanner(item)->tick().ticks());
+        }
+    }
+
+    const Measure* measure = score->tick2measureMM(Fraction::fromTicks(tick));
+    const System* system = measure ? measure->system() : nullptr;
+    const Page* page = system ? system->page() : nullptr;
+    if (!page) {
+        m_tileCache.invalidate();
+        return;
+    }
+
+    //! NOTE The relayout reflows all the following systems,
+    //! and may move the first of them to the previous page
+    m_tileCache.onChangesRange(page->no() > 0 ? page->no() - 1 : 0);
+}
+
+void AbstractNotationPaintView::invalidateTilesOfSelection()
+{
+    //! NOTE The selected items are painted with the selection colors,
+    //! so the tiles of both the old and the new selection are outdated
+    static constexpr size_t MAX_SELECTION_RECTS = 1000;
+
+    std::vector<RectF> selectionRects;
+    for (const EngravingItem* item : notationSelection()->elements()) {
+        selectionRects.push_back(item->canvasBoundingRect());
+    }
+
+    if (m_selectionRects.size() + selectionRects.size() > MAX_SELECTION_RECTS) {
+        m_tileCache.invalidate();
+    } else {
+        for (const RectF& rect : m_selectionRects) {
+            invalidateTilesInRect(rect);
+        }
+
+        for (const RectF& rect : selectionRects) {
+            invalidateTilesInRect(rect);
+        }
+    }
+
+    m_selectionRects = std::move(selectionRects);
+}
+
+void AbstractNotationPaintView::invalidateTilesInRect(const RectF& canvasRect)
+{
+    for (const Page* page : notationElements()->pages()) {
+        RectF pageRect = page->ldata()->bbox().translated(page->pos());
+        if (!pageRect.intersects(canvasRect)) {
+            continue;
+        }
+
+        m_tileCache.invalidatePageRect(page->no(), canvasRect.intersected(pageRect).translated(-page->pos()));
+    }
+}
+
 PointF AbstractNotationPaintView::canvasCenter() const
 {
     TRACEFUNC;
@@ -45,6 +45,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 #include "internal/abstractelementpopupmodel.h"
 
 namespace mu::notation {
@@ -247,6 +248,11 @@ private:
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
 
+    bool isTileCacheUsed() const;
+    void invalidateTiles(const ChangesRange& range);
+    void invalidateTilesOfSelection();
+    void invalidateTilesInRect(const RectF& canvasRect);
+
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
 
@@ -274,6 +280,9 @@ private:
     bool m_isContextMenuOpen = false;
 
     RectF m_shadowNoteRect;
+
+    NotationTileCache m_tileCache;
+    std::vector<RectF> m_selectionRects;
 };
 }
 
@@ -0,0 +1,244 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPainter>
+
+#include "engraving/dom/page.h"
+
+#include "realfn.h"
+
+#include "log.h"
+
+using namespace mu::notation;
+using namespace mu::draw;
+
+//! NOTE In view pixels
+static constexpr int TILE_SIZE = 256;
+static constexpr size_t MAX_MEMORY_USAGE = 128 * 1024 * 1024;
+static constexpr double INCHES_PER_METER = 39.3700787;
+
+static constexpr int TILE_INDEX_BITS = 20;
+static constexpr uint64_t TILE_INDEX_MASK = (uint64_t(1) << TILE_INDEX_BITS) - 1;
+
+uint64_t NotationTileCache::tileKey(size_t pageIndex, int column, int row)
+{
+    return (uint64_t(pageIndex) << (2 * TILE_INDEX_BITS))
+           | ((uint64_t(column) & TILE_INDEX_MASK) << TILE_INDEX_BITS)
+           | (uint64_t(row) & TILE_INDEX_MASK);
+}
+
+static size_t pageIndexFromKey(uint64_t key)
+{
+    return static_cast<size_t>(key >> (2 * TILE_INDEX_BITS));
+}
+
+void NotationTileCache::paint(QPainter* painter, const RectF& rect, const PageList& pages, const Transform& matrix, bool isPrinting,
+                              const PaintPageFunc& paintPage)
+{
+    TRACEFUNC;
+
+    const double dpr = painter->device()->devicePixelRatioF();
+    setParams(matrix.m11(), dpr, isPrinting);
+    ++m_frame;
+
+    for (const engraving::Page* page : pages) {
+        const RectF pageRect = page->ldata()->bbox();
+        const RectF viewPageRect = matrix.map(pageRect.translated(page->pos()));
+        if (!viewPageRect.intersects(rect)) {
+            continue;
+        }
+
+        //! NOTE Align the page origin to device pixels, so that the tiles are blitted without resampling
+        const PointF viewPagePos = matrix.map(page->pos());
+        const PointF origin(std::round(viewPagePos.x() * dpr) / dpr, std::round(viewPagePos.y() * dpr) / dpr);
+
+        const int columnCount = static_cast<int>(std::ceil(pageRect.right() * m_scaling / TILE_SIZE));
+        const int rowCount = static_cast<int>(std::ceil(pageRect.bottom() * m_scaling / TILE_SIZE));
+
+        const int firstColumn = std::max(0, static_cast<int>(std::floor((rect.left() - origin.x()) / TILE_SIZE)));
+        const int lastColumn = std::min(columnCount - 1, static_cast<int>(std::floor((rect.right() - origin.x()) / TILE_SIZE)));
+        const int firstRow = std::max(0, static_cast<int>(std::floor((rect.top() - origin.y()) / TILE_SIZE)));
+        const int lastRow = std::min(rowCount - 1, static_cast<int>(std::floor((rect.bottom() - origin.y()) / TILE_SIZE)));
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                const uint64_t key = tileKey(page->no(), column, row);
+
+                auto it = m_tiles.find(key);
+                if (it == m_tiles.end()) {
+                    Tile tile;
+                    tile.image = renderTile(painter, page, column, row, paintPage);
+                    m_memoryUsage += static_cast<size_t>(tile.image.sizeInBytes());
+                    it = m_tiles.emplace(key, std::move(tile)).first;
+                }
+
+                it->second.lastUsedFrame = m_frame;
+                painter->drawImage(QPointF(origin.x() + column * TILE_SIZE, origin.y() + row * TILE_SIZE), it->second.image);
+            }
+        }
+    }
+
+    evictUnusedTiles();
+}
+
+QImage NotationTileCache::renderTile(const QPainter* target, const engraving::Page* page, int column, int row,
+                                     const PaintPageFunc& paintPage) const
+{
+    TRACEFUNC;
+
+    const int size = static_cast<int>(std::ceil(TILE_SIZE * m_devicePixelRatio));
+
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(m_devicePixelRatio);
+
+    //! NOTE Fonts are sized in points, so the tile must have the same resolution as the view
+    const QPaintDevice* device = target->device();
+    image.setDotsPerMeterX(static_cast<int>(std::lrint(device->logicalDpiX() * INCHES_PER_METER)));
+    image.setDotsPerMeterY(static_cast<int>(std::lrint(device->logicalDpiY() * INCHES_PER_METER)));
+
+    image.fill(Qt::transparent);
+
+    const double tileSize = TILE_SIZE / m_scaling;
+    const PointF tilePos(page->pos().x() + column * tileSize, page->pos().y() + row * tileSize);
+
+    {
+        QPainter qp(&image);
+        qp.setRenderHints(target->renderHints());
+
+        Painter painter(&qp, "notationtile");
+        painter.setWorldTransform(Transform(m_scaling, 0.0, 0.0, m_scaling, -tilePos.x() * m_scaling, -tilePos.y() * m_scaling));
+
+        paintPage(&painter, page->no(), RectF(tilePos.x(), tilePos.y(), tileSize, tileSize));
+    }
+
+    return image;
+}
+
+void NotationTileCache::setParams(double scaling, double devicePixelRatio, bool isPrinting)
+{
+    if (RealIsEqual(m_scaling, scaling) && RealIsEqual(m_devicePixelRatio, devicePixelRatio) && m_isPrinting == isPrinting) {
+        return;
+    }
+
+    invalidate();
+
+    m_scaling = scaling;
+    m_devicePixelRatio = devicePixelRatio;
+    m_isPrinting = isPrinting;
+}
+
+void NotationTileCache::evictUnusedTiles()
+{
+    if (m_memoryUsage <= MAX_MEMORY_USAGE) {
+        return;
+    }
+
+    //! NOTE The tiles of the current frame are never evicted, even if they alone exceed the limit
+    std::vector<std::pair<uint64_t, uint64_t> > candidates; // last used frame, key
+    for (const auto& pair : m_tiles) {
+        if (pair.second.lastUsedFrame < m_frame) {
+            candidates.emplace_back(pair.second.lastUsedFrame, pair.first);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        if (m_memoryUsage <= MAX_MEMORY_USAGE) {
+            break;
+        }
+
+        auto it = m_tiles.find(candidate.second);
+        m_memoryUsage -= static_cast<size_t>(it->second.image.sizeInBytes());
+        m_tiles.erase(it);
+    }
+}
+
+void NotationTileCache::invalidate()
+{
+    m_tiles.clear();
+    m_memoryUsage = 0;
+}
+
+void NotationTileCache::invalidatePagesFrom(size_t pageIndex)
+{
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        if (pageIndexFromKey(it->first) >= pageIndex) {
+            m_memoryUsage -= static_cast<size_t>(it->second.image.sizeInBytes());
+            it = m_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void NotationTileCache::onChangesRange(size_t fromPageIndex)
+{
+    invalidatePagesFrom(fromPageIndex);
+    m_changesRangeApplied = true;
+}
+
+void NotationTileCache::onNotationChanged()
+{
+    if (!m_changesRangeApplied) {
+        invalidate();
+    }
+
+    m_changesRangeApplied = false;
+}
+
+void NotationTileCache::invalidatePageRect(size_t pageIndex, const RectF& rect)
+{
+    if (m_tiles.empty() || m_scaling <= 0.0) {
+        return;
+    }
+
+    //! NOTE One more view pixel around the rect for the antialiasing
+    const int firstColumn = std::max(0, static_cast<int>(std::floor((rect.left() * m_scaling - 1) / TILE_SIZE)));
+    const int lastColumn = static_cast<int>(std::floor((rect.right() * m_scaling + 1) / TILE_SIZE));
+    const int firstRow = std::max(0, static_cast<int>(std::floor((rect.top() * m_scaling - 1) / TILE_SIZE)));
+    const int lastRow = static_cast<int>(std::floor((rect.bottom() * m_scaling + 1) / TILE_SIZE));
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            auto it = m_tiles.find(tileKey(pageIndex, column, row));
+            if (it != m_tiles.end()) {
+                m_memoryUsage -= static_cast<size_t>(it->second.image.sizeInBytes());
+                m_tiles.erase(it);
+            }
+        }
+    }
+}
+
+size_t NotationTileCache::tileCount() const
+{
+    return m_tiles.size();
+}
+
+size_t NotationTileCache::memoryUsage() const
+{
+    return m_memoryUsage;
+}
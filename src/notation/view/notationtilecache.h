@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <functional>
+#include <unordered_map>
+
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/types/transform.h"
+
+#include "notation/notationtypes.h"
+
+class QPainter;
+
+namespace mu::notation {
+//---------------------------------------------------------
+//   NotationTileCache
+//    Raster cache of the score content shown by the notation view.
+//    Every page is split into square tiles in view pixels,
+//    so a tile is identified by its page and its position on the page,
+//    and is valid for one zoom level, device pixel ratio and print mode.
+//    Panning or moving the playback cursor only blits existing tiles;
+//    tiles are re-rendered after they were invalidated by a relayout.
+//    The playback cursor, loop markers and interaction overlays are
+//    painted on top of the tiles and are never cached.
+//---------------------------------------------------------
+
+class NotationTileCache
+{
+public:
+    using PaintPageFunc = std::function<void (draw::Painter* painter, size_t pageIndex, const RectF& frameRect)>;
+
+    //! NOTE rect is in view coordinates, matrix maps the canvas to the view
+    void paint(QPainter* painter, const RectF& rect, const PageList& pages, const draw::Transform& matrix, bool isPrinting,
+               const PaintPageFunc& paintPage);
+
+    void invalidate();
+    void invalidatePagesFrom(size_t pageIndex);
+
+    //! NOTE An undoable change reports the range of its relayout right before the notation
+    //! notifies about the change, only the pages of that range are invalidated then.
+    //! Any other notification about a change of the notation invalidates every tile.
+    void onChangesRange(size_t fromPageIndex);
+    void onNotationChanged();
+
+    //! NOTE rect is in page coordinates
+    void invalidatePageRect(size_t pageIndex, const RectF& rect);
+
+    size_t tileCount() const;
+    size_t memoryUsage() const;
+
+private:
+    struct Tile {
+        QImage image;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    static uint64_t tileKey(size_t pageIndex, int column, int row);
+
+    void setParams(double scaling, double devicePixelRatio, bool isPrinting);
+    QImage renderTile(const QPainter* target, const engraving::Page* page, int column, int row, const PaintPageFunc& paintPage) const;
+    void evictUnusedTiles();
+
+    std::unordered_map<uint64_t, Tile> m_tiles;
+    size_t m_memoryUsage = 0;
+    uint64_t m_frame = 0;
+
+    double m_scaling = 0.0;
+    double m_devicePixelRatio = 0.0;
+    bool m_isPrinting = false;
+
+    bool m_changesRangeApplied = false;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
@@ -326,10 +326,13 @@ void EditStaff::bboxClicked(QAbstractButton* button)
 
 void EditStaff::apply()
 {
-    size_t index = m_staff->score()->undoStack()->getCurIdx();
+    UndoStack* undoStack = m_staff->score()->undoStack();
+    size_t index = undoStack->getCurIdx();
+    undoStack->setReleaseFloor(index);
     applyStaffProperties();
     applyPartProperties();
-    m_staff->score()->undoStack()->mergeCommands(index);
+    undoStack->mergeCommands(index);
+    undoStack->setReleaseFloor(mu::nidx);
 }
 
 void EditStaff::minPitchAClicked()
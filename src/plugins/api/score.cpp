@@ -156,6 +156,22 @@ void Score::appendPartByMusicXmlId(const QString& instrumentMusicXmlId)
     score()->appendPart(t);
 }
 
+//---------------------------------------------------------
+//   Score::elementByEID
+//---------------------------------------------------------
+
+ScoreElement* Score::elementByEID(const QString& eid)
+{
+    bool ok = false;
+    const uint64_t value = eid.toULongLong(&ok);
+    if (!ok) {
+        return nullptr;
+    }
+
+    mu::engraving::EngravingObject* obj = score()->itemByEID(mu::engraving::EID::fromUint64(value));
+    return obj ? wrap(obj, Ownership::SCORE) : nullptr;
+}
+
 //---------------------------------------------------------
 //   Score::firstSegment
 //---------------------------------------------------------
@@ -190,6 +190,14 @@ public:
     /// Creates and returns a cursor to be used to navigate in the score
     Q_INVOKABLE mu::plugins::api::Cursor* newCursor();
 
+    /**
+     * Finds an element of this score or one of its parts
+     * by its identifier, as given by ScoreElement::eid.
+     * \returns The element, or null if no such element exists.
+     * \since MuseScore 4.3
+     */
+    Q_INVOKABLE mu::plugins::api::ScoreElement* elementByEID(const QString& eid);
+
     Q_INVOKABLE mu::plugins::api::Segment* firstSegment();   // TODO: segment type
     /// \cond MS_INTERNAL
     Segment* lastSegment();
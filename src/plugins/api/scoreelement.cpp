@@ -55,6 +55,11 @@ int ScoreElement::type() const
     return int(e->type());
 }
 
+QString ScoreElement::eid() const
+{
+    return QString::fromStdString(e->eid().toStdString());
+}
+
 //---------------------------------------------------------
 //   ScoreElement::userName
 ///   \brief Human-readable element type name
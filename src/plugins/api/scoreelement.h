@@ -66,6 +66,13 @@ class ScoreElement : public QObject
      * element name suitable for usage in a user interface.
      */
     Q_PROPERTY(QString name READ name)
+    /**
+     * Unique identifier of this element within its score and
+     * all of its parts (read only). Can be used to find the
+     * element again with Score::elementByEID().
+     * \since MuseScore 4.3
+     */
+    Q_PROPERTY(QString eid READ eid)
 
     Ownership _ownership;
 
@@ -92,6 +99,7 @@ public:
 
     QString name() const;
     int type() const;
+    QString eid() const;
 
     QVariant get(mu::engraving::Pid pid) const;
     void set(mu::engraving::Pid pid, const QVariant& val);
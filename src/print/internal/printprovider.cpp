@@ -24,6 +24,8 @@
 #include <QPrinter>
 #include <QPrintDialog>
 
+#include "engraving/dom/score.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -37,6 +39,12 @@ Ret PrintProvider::printNotation(INotationPtr notation)
         return make_ret(Ret::Code::InternalError);
     }
 
+    //! NOTE The layout of the score may still be continuing in the background, all the pages are needed here
+    mu::engraving::Score* score = notation->elements()->msScore();
+    if (score && score->isLayoutPending()) {
+        score->continueLayout();
+    }
+
     auto painting = notation->painting();
 
     SizeF pageSizeInch = painting->pageSizeInch();
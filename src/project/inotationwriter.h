@@ -23,6 +23,8 @@
 #ifndef MU_PROJECT_INOTATIONWRITER_H
 #define MU_PROJECT_INOTATIONWRITER_H
 
+#include <vector>
+
 #include "types/ret.h"
 #include "types/val.h"
 
@@ -58,6 +60,28 @@ public:
     virtual Ret write(notation::INotationPtr notation, QIODevice& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, QIODevice& device, const Options& options = Options()) = 0;
 
+    struct PageDevice {
+        int page = 0;
+        QIODevice* device = nullptr;
+    };
+
+    //! Write each of the given pages to its own device.
+    //! Writers may prepare several pages concurrently; all devices are written when this returns.
+    virtual Ret writePages(notation::INotationPtr notation, const std::vector<PageDevice>& pages, const Options& options = Options())
+    {
+        for (const PageDevice& page : pages) {
+            Options pageOptions = options;
+            pageOptions[OptionKey::PAGE_NUMBER] = Val(page.page);
+
+            Ret ret = write(notation, *page.device, pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
     virtual framework::Progress* progress() { return nullptr; }
     virtual void abort() {}
 };
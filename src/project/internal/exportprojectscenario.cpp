@@ -128,11 +128,14 @@ bool ExportProjectScenario::exportScores(const notation::INotationPtrList& notat
 
     masterNotation()->initExcerpts(excerptsToInit);
 
-    // Scores that are closed may have never been laid out, so we lay them out now
+    // Scores that are closed may have never been laid out, so we lay them out now,
+    // the layout of an open score may still be continuing in the background
     for (INotationPtr notation : notations) {
         mu::engraving::Score* score = notation->elements()->msScore();
         if (!score->autoLayoutEnabled()) {
             score->doLayout();
+        } else if (score->isLayoutPending()) {
+            score->continueLayout();
         }
     }
 
@@ -52,6 +52,10 @@ using namespace mu::engraving;
 using namespace mu::notation;
 using namespace mu::project;
 
+//! NOTE The number of pages laid out before the opened score is shown,
+//! the notation lays out the rest in the background
+static constexpr size_t FIRST_LAYOUT_PAGE_COUNT = 4;
+
 static void setupScoreMetaTags(mu::engraving::MasterScore* masterScore, const ProjectCreateOptions& projectOptions)
 {
     if (!projectOptions.title.isEmpty()) {
@@ -192,7 +196,15 @@ mu::Ret NotationProject::doLoad(const io::path_t& path, const io::path_t& styleP
 
     masterScore->lockUpdates(false);
     masterScore->setLayoutAll();
+
+    //! NOTE Without the event loop nothing would continue the layout
+    bool isProgressiveLayout = application() && application()->runMode() == framework::IApplication::RunMode::GuiApp;
+    if (isProgressiveLayout) {
+        masterScore->setLayoutPageLimit(FIRST_LAYOUT_PAGE_COUNT);
+    }
+
     masterScore->update();
+    masterScore->setLayoutPageLimit(0);
 
     // Load audio settings
     ret = m_projectAudioSettings->read(reader);
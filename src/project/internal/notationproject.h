@@ -28,6 +28,7 @@
 
 #include "modularity/ioc.h"
 #include "io/ifilesystem.h"
+#include "iapplication.h"
 #include "../iprojectconfiguration.h"
 #include "inotationreadersregister.h"
 #include "inotationwritersregister.h"
@@ -48,6 +49,7 @@ namespace mu::project {
 class NotationProject : public INotationProject, public async::Asyncable
 {
     INJECT(io::IFileSystem, fileSystem)
+    INJECT(framework::IApplication, application)
     INJECT(IProjectConfiguration, configuration)
     INJECT(notation::INotationConfiguration, notationConfiguration)
     INJECT(notation::INotationCreator, notationCreator)